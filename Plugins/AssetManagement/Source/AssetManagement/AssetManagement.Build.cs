@@ -1,31 +1,34 @@
-using UnrealBuildTool;
-
-public class AssetManagement : ModuleRules
-{
-    public AssetManagement(ReadOnlyTargetRules Target) : base(Target)
-    {
-        PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
-        
-        PublicDependencyModuleNames.AddRange(
-            new string[]
-            {
-                "Core"
-            }
-        );
-            
-        PrivateDependencyModuleNames.AddRange(
-            new string[]
-            {
-                "CoreUObject",
-                "Engine",
-                "Slate",
-                "SlateCore",
-                "UnrealEd",
-                "EditorStyle",
-                "UMGEditor",
-                "Projects",
-                "Json"
-            }
-        );
-    }
-}
+using UnrealBuildTool;
+
+public class AssetManagement : ModuleRules
+{
+    public AssetManagement(ReadOnlyTargetRules Target) : base(Target)
+    {
+        PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+        
+        PublicDependencyModuleNames.AddRange(
+            new string[]
+            {
+                "Core",
+                "CoreUObject",
+                "AssetRegistry"
+            }
+        );
+            
+        PrivateDependencyModuleNames.AddRange(
+            new string[]
+            {
+                "Engine",
+                "Slate",
+                "SlateCore",
+                "UnrealEd",
+                "EditorStyle",
+                "UMGEditor",
+                "Projects",
+                "Json",
+                "SourceControl",
+                "DesktopPlatform"
+            }
+        );
+    }
+}
@@ -0,0 +1,169 @@
+#include "AssetActionCycleCheck.h"
+#include "AssetMagementCore.h"
+#include "AssetDependencyGraph.h"
+#include "AssetRegistryModule.h"
+#include "Editor.h"
+
+#define MAX_LISTED_CYCLE_MEMBERS 5
+
+void AssetActionCycleCheck::ScanAssets(TArray<FAssetInfo>& Assets, uint16 AssignedId)
+{
+    Cycles.Reset();
+    CycleSizes.Reset();
+    CycleLookup.Reset();
+
+    AssetManager* manager = AssetManager::Get();
+    if (manager == nullptr) return;
+
+    const AssetDependencyGraph& Graph = manager->GetDependencyGraph();
+    const int32 NodeCount = Graph.Num();
+
+    // Iterative Tarjan, every node and edge is visited exactly once
+    struct FFrame
+    {
+        int32 Node;
+        int32 Edge;
+    };
+
+    TArray<int32> NodeIndex;
+    NodeIndex.Init(INDEX_NONE, NodeCount);
+    TArray<int32> LowLink;
+    LowLink.SetNumUninitialized(NodeCount);
+    TBitArray<> OnStack(false, NodeCount);
+
+    TArray<int32> Stack;
+    TArray<FFrame> CallStack;
+    int32 NextIndex = 0;
+
+    for (int32 Root = 0; Root < NodeCount; Root++)
+    {
+        if (NodeIndex[Root] != INDEX_NONE) continue;
+
+        NodeIndex[Root] = LowLink[Root] = NextIndex++;
+        Stack.Add(Root);
+        OnStack[Root] = true;
+        CallStack.Add({ Root, 0 });
+
+        while (CallStack.Num() > 0)
+        {
+            const int32 Node = CallStack.Last().Node;
+            TArrayView<const int32> Dependencies = Graph.GetDependencies(Node);
+
+            if (CallStack.Last().Edge < Dependencies.Num())
+            {
+                const int32 Next = Dependencies[CallStack.Last().Edge++];
+
+                if (NodeIndex[Next] == INDEX_NONE)
+                {
+                    NodeIndex[Next] = LowLink[Next] = NextIndex++;
+                    Stack.Add(Next);
+                    OnStack[Next] = true;
+                    CallStack.Add({ Next, 0 });
+                }
+                else if (OnStack[Next])
+                {
+                    LowLink[Node] = FMath::Min(LowLink[Node], NodeIndex[Next]);
+                }
+
+                continue;
+            }
+
+            CallStack.Pop(false);
+            if (CallStack.Num() > 0)
+            {
+                const int32 Parent = CallStack.Last().Node;
+                LowLink[Parent] = FMath::Min(LowLink[Parent], LowLink[Node]);
+            }
+
+            if (LowLink[Node] != NodeIndex[Node]) continue;
+
+            TArray<FName> Members;
+            int64 TotalSize = 0;
+            int32 Member;
+            do
+            {
+                Member = Stack.Pop(false);
+                OnStack[Member] = false;
+                Members.Add(Graph.GetPackageName(Member));
+                TotalSize += Graph.GetPackageSize(Member);
+            }
+            while (Member != Node);
+
+            if (Members.Num() >= 2)
+            {
+                Cycles.Add(Members);
+                CycleSizes.Add(TotalSize);
+            }
+        }
+    }
+
+    for (int32 i = 0; i < Cycles.Num(); i++)
+    {
+        Cycles[i].Sort([](const FName& A, const FName& B) { return A.Compare(B) < 0; });
+
+        for (FName& PackageName : Cycles[i])
+        {
+            CycleLookup.Add(PackageName, i);
+        }
+    }
+
+    for (FAssetInfo& Asset : Assets)
+    {
+        const int32* Cycle = CycleLookup.Find(Asset.Data.PackageName);
+        if (Cycle != nullptr)
+        {
+            Asset.ActionResults.Add(AssignedId, Cycles[*Cycle][0]);
+        }
+    }
+}
+
+FString AssetActionCycleCheck::FormatResult(FName Result)
+{
+    // Results restored from the index are shown before the first scan has found the cycles
+    const int32* Cycle = CycleLookup.Find(Result);
+    if (Cycle == nullptr) return "includes " + Result.ToString();
+
+    const TArray<FName>& Members = Cycles[*Cycle];
+
+    FString Summary = FString::FromInt(Members.Num()) + " packages, " + FText::AsMemory(CycleSizes[*Cycle]).ToString() + "\n";
+    for (int32 i = 0; i < Members.Num() && i < MAX_LISTED_CYCLE_MEMBERS; i++)
+    {
+        Summary += "\n" + Members[i].ToString();
+    }
+
+    if (Members.Num() > MAX_LISTED_CYCLE_MEMBERS)
+    {
+        Summary += "\n... and " + FString::FromInt(Members.Num() - MAX_LISTED_CYCLE_MEMBERS) + " more";
+    }
+
+    return Summary;
+}
+
+void AssetActionCycleCheck::ExecuteAction(TArray<FAssetData> Assets)
+{
+    FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
+    IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
+
+    TSet<int32> SelectedCycles;
+    for (FAssetData& Asset : Assets)
+    {
+        const int32* Cycle = CycleLookup.Find(Asset.PackageName);
+        if (Cycle != nullptr) SelectedCycles.Add(*Cycle);
+    }
+
+    TArray<FAssetData> Members;
+    for (int32 Cycle : SelectedCycles)
+    {
+        for (FName& PackageName : Cycles[Cycle])
+        {
+            TArray<FAssetData> PackageAssets;
+            AssetRegistry.GetAssetsByPackageName(PackageName, PackageAssets);
+            Members.Append(PackageAssets);
+        }
+    }
+
+    if (Members.Num() > 0)
+    {
+        GEditor->SyncBrowserToObjects(Members);
+    }
+}
@@ -0,0 +1,24 @@
+#pragma once
+#include "AssetAction.h"
+
+class AssetActionCycleCheck : public IAssetAction
+{
+public:
+    void ScanAssets(TArray<FAssetInfo>& Assets, uint16 AssignedId) override;
+    void ExecuteAction(TArray<FAssetData> Assets) override;
+    FString GetTooltipHeading() override { return "Circular reference"; }
+    FString GetTooltipContent() override { return "This asset is part of a reference cycle.\n\nCycle: {Asset}\n\nClick to show all packages in the cycle"; }
+    FString GetFilterName() override { return "Circular references"; }
+    FString GetApplyAllTag() override { return "Show all circular references"; }
+    FString GetButtonStyleName() override { return "Action.Cycle"; }
+    uint32 GetRequirements() override { return AAR_Dependencies; }
+    EAssetActionGranularity GetGranularity() override { return AAG_WholeGraph; }
+    // Results are the first package of the cycle in name order, the same for every member
+    FString FormatResult(FName Result) override;
+
+private:
+    // Strongly connected components with two or more packages
+    TArray<TArray<FName>> Cycles;
+    TArray<int64> CycleSizes;
+    TMap<FName, int32> CycleLookup;
+};
@@ -0,0 +1,309 @@
+#include "AssetActionDuplicateCheck.h"
+#include "AssetMagementCore.h"
+#include "PackageHashCache.h"
+#include "RedirectorResolver.h"
+#include "AssetRegistryModule.h"
+#include "ObjectTools.h"
+#include "FileHelpers.h"
+#include "ISourceControlModule.h"
+#include "Engine/Texture.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/SkeletalMesh.h"
+#include "Sound/SoundWave.h"
+
+#define DUPLICATE_VARIANT_RESULT TEXT("DuplicateSettingsVariant")
+
+void AssetActionDuplicateCheck::ScanAssets(TArray<FAssetInfo>& Assets, uint16 AssignedId)
+{
+    // Whole graph actions always receive every asset, so the groups can be rebuilt from scratch
+    DuplicateOf.Reset();
+    Variants.Reset();
+
+    TArray<int32> Candidates;
+    TArray<FString> Filenames;
+    TArray<UClass*> Classes;
+
+    for (int32 i = 0; i < Assets.Num(); i++)
+    {
+        if (Assets[i].IsSuppressed(AssignedId)) continue;
+
+        UClass* Class = Assets[i].Data.GetClass();
+        if (Class == nullptr || !IsCandidate(Class)) continue;
+
+        Candidates.Add(i);
+        Filenames.Add(PackageHashCache::GetPackageFilename(Assets[i].Data));
+        Classes.Add(Class);
+    }
+
+    PackageHashCache& HashCache = PackageHashCache::Get();
+
+    // Only packages sharing a class and payload size can be duplicates, so hash just those
+    HashCache.Update(Filenames, EPackageHashType::PayloadSize);
+
+    TMap<TPair<UClass*, int64>, TArray<int32>> SizeGroups;
+    for (int32 i = 0; i < Candidates.Num(); i++)
+    {
+        const FPackageHashEntry* Entry = HashCache.Find(Filenames[i]);
+        if (Entry == nullptr || Entry->PayloadSize <= 0) continue;
+
+        SizeGroups.FindOrAdd(TPair<UClass*, int64>(Classes[i], Entry->PayloadSize)).Add(i);
+    }
+
+    TArray<int32> ToHash;
+    TArray<FString> ToHashFilenames;
+    for (auto& Group : SizeGroups)
+    {
+        if (Group.Value.Num() < 2) continue;
+
+        for (int32 Candidate : Group.Value)
+        {
+            ToHash.Add(Candidate);
+            ToHashFilenames.Add(Filenames[Candidate]);
+        }
+    }
+
+    HashCache.Update(ToHashFilenames, EPackageHashType::PayloadHash);
+    HashCache.Save();
+
+    TMap<TPair<UClass*, FSHAHash>, TArray<int32>> HashGroups;
+    for (int32 Candidate : ToHash)
+    {
+        const FPackageHashEntry* Entry = HashCache.Find(Filenames[Candidate]);
+        if (Entry == nullptr || !EnumHasAnyFlags(Entry->ValidTypes, EPackageHashType::PayloadHash)) continue;
+
+        HashGroups.FindOrAdd(TPair<UClass*, FSHAHash>(Classes[Candidate], Entry->PayloadHash)).Add(Candidate);
+    }
+
+    AssetManager* manager = AssetManager::Get();
+
+    // Keep the most referenced asset so the fewest packages have to be resaved
+    auto ChooseOriginal = [&](const TArray<int32>& Group)
+    {
+        int32 Original = INDEX_NONE;
+        int32 OriginalReferencers = -1;
+        for (int32 Candidate : Group)
+        {
+            const FAssetData& Data = Assets[Candidates[Candidate]].Data;
+
+            int32 Referencers = 0;
+            if (manager != nullptr)
+            {
+                const int32 Node = manager->GetDependencyGraph().FindNode(Data.PackageName);
+                if (Node != INDEX_NONE) Referencers = manager->GetDependencyGraph().GetReferencers(Node).Num();
+            }
+
+            if (Referencers > OriginalReferencers || (Referencers == OriginalReferencers && Data.PackageName.Compare(Assets[Candidates[Original]].Data.PackageName) < 0))
+            {
+                Original = Candidate;
+                OriginalReferencers = Referencers;
+            }
+        }
+
+        return Original;
+    };
+
+    for (auto& Group : HashGroups)
+    {
+        if (Group.Value.Num() < 2) continue;
+
+        // The same source imported as a normal map and as a color texture is not a duplicate, only copies with equal settings are merged
+        TMap<FString, TArray<int32>> SettingGroups;
+        for (int32 Candidate : Group.Value)
+        {
+            SettingGroups.FindOrAdd(GetSettings(Assets[Candidates[Candidate]].Data, Classes[Candidate])).Add(Candidate);
+        }
+
+        TArray<int32> Originals;
+        for (auto& SettingGroup : SettingGroups)
+        {
+            const int32 Original = ChooseOriginal(SettingGroup.Value);
+            Originals.Add(Original);
+
+            const FAssetData& OriginalData = Assets[Candidates[Original]].Data;
+            for (int32 Candidate : SettingGroup.Value)
+            {
+                if (Candidate == Original) continue;
+
+                FAssetInfo& Asset = Assets[Candidates[Candidate]];
+                DuplicateOf.Add(Asset.Data.PackageName, OriginalData);
+                Asset.ActionResults.Add(AssignedId, OriginalData.PackageName);
+            }
+        }
+
+        if (Originals.Num() < 2) continue;
+
+        const int32 VariantId = Variants.Num();
+        TArray<FAssetData>& Variant = Variants[Variants.AddDefaulted()];
+        for (int32 Original : Originals)
+        {
+            FAssetInfo& Asset = Assets[Candidates[Original]];
+            Variant.Add(Asset.Data);
+            Asset.ActionResults.Add(AssignedId, FName(DUPLICATE_VARIANT_RESULT, VariantId + 1));
+        }
+    }
+}
+
+void AssetActionDuplicateCheck::ExecuteAction(TArray<FAssetData> Assets)
+{
+    TMap<FName, TArray<FAssetData>> Groups;
+    TMap<FName, FAssetData> Originals;
+
+    for (FAssetData& Asset : Assets)
+    {
+        const FAssetData* Original = DuplicateOf.Find(Asset.PackageName);
+        if (Original == nullptr) continue;
+
+        Groups.FindOrAdd(Original->PackageName).Add(Asset);
+        Originals.Add(Original->PackageName, *Original);
+    }
+
+    TArray<UPackage*> DirtiedPackages;
+    TArray<FName> Consolidated;
+    for (auto& Group : Groups)
+    {
+        UObject* Original = Originals[Group.Key].GetAsset();
+        if (Original == nullptr) continue;
+
+        TArray<UObject*> Duplicates;
+        for (FAssetData& Duplicate : Group.Value)
+        {
+            UObject* Object = Duplicate.GetAsset();
+            if (Object == nullptr) continue;
+
+            Duplicates.Add(Object);
+            Consolidated.Add(Duplicate.PackageName);
+        }
+
+        if (Duplicates.Num() == 0) continue;
+
+        ObjectTools::FConsolidationResults Results = ObjectTools::ConsolidateObjects(Original, Duplicates, false);
+        for (UPackage* Package : Results.DirtiedPackages)
+        {
+            DirtiedPackages.AddUnique(Package);
+        }
+    }
+
+    if (DirtiedPackages.Num() > 0)
+    {
+        FEditorFileUtils::PromptForCheckoutAndSave(DirtiedPackages, false, false, nullptr, true);
+        ISourceControlModule::Get().QueueStatusUpdate(DirtiedPackages);
+    }
+
+    // Consolidation leaves redirectors behind for unloaded referencers, only those are fixed
+    AssetManager* manager = AssetManager::Get();
+    if (manager != nullptr && Consolidated.Num() > 0)
+    {
+        FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
+
+        RedirectorResolver Resolver;
+        Resolver.Build(AssetRegistryModule.Get());
+        Resolver.Fix(Consolidated, AssetRegistryModule.Get(), manager->GetLoader());
+    }
+}
+
+FString AssetActionDuplicateCheck::FormatResult(FName Result)
+{
+    if (!IsVariantResult(Result))
+    {
+        return "Duplicate of: " + Result.ToString() + "\n\nClick to replace all references with the original and remove this asset";
+    }
+
+    // Results restored from the index of a previous session have no groups until the next scan
+    const int32 VariantId = Result.GetNumber() - 1;
+    if (!Variants.IsValidIndex(VariantId)) return "Imported from the same source as other assets, but with different settings. These copies are not merged";
+
+    const TArray<FAssetData>& Variant = Variants[VariantId];
+    FString Text = "Imported from the same source as " + FString::FromInt(Variant.Num() - 1) + " other asset(s), but with different settings. These copies are not merged";
+
+    for (const FName& Tag : GetSettingTags(Variant[0].GetClass()))
+    {
+        TArray<FString> Values;
+        bool Differs = false;
+        for (const FAssetData& Asset : Variant)
+        {
+            FString Value;
+            Asset.GetTagValue(Tag, Value);
+            Differs |= Values.Num() > 0 && !Value.Equals(Values[0], ESearchCase::CaseSensitive);
+            Values.Add(Value);
+        }
+
+        if (!Differs) continue;
+
+        Text += "\n\n" + Tag.ToString() + ":";
+        for (int32 i = 0; i < Variant.Num(); i++)
+        {
+            Text += "\n    " + Variant[i].AssetName.ToString() + ": " + (Values[i].IsEmpty() ? FString("-") : Values[i]);
+        }
+    }
+
+    return Text;
+}
+
+bool AssetActionDuplicateCheck::IsCandidate(UClass* Class)
+{
+    return Class->IsChildOf(UTexture::StaticClass())
+        || Class->IsChildOf(UStaticMesh::StaticClass())
+        || Class->IsChildOf(USkeletalMesh::StaticClass())
+        || Class->IsChildOf(USoundWave::StaticClass());
+}
+
+const TArray<FName>& AssetActionDuplicateCheck::GetSettingTags(UClass* Class)
+{
+    static const TArray<FName> TextureTags = { TEXT("CompressionSettings"), TEXT("SRGB"), TEXT("LODGroup"), TEXT("Filter"), TEXT("MipGenSettings"),
+        TEXT("AddressX"), TEXT("AddressY"), TEXT("CompressionNoAlpha"), TEXT("NeverStream"), TEXT("Dimensions"), TEXT("Format") };
+    static const TArray<FName> StaticMeshTags = { TEXT("LODGroup"), TEXT("LODs"), TEXT("MinLOD"), TEXT("Materials"), TEXT("Triangles"), TEXT("Vertices"),
+        TEXT("UVChannels"), TEXT("CollisionComplexity"), TEXT("DefaultCollision"), TEXT("NaniteEnabled") };
+    static const TArray<FName> SkeletalMeshTags = { TEXT("Skeleton"), TEXT("PhysicsAsset"), TEXT("LODs"), TEXT("Materials"), TEXT("Triangles"), TEXT("Vertices"), TEXT("Bones") };
+    static const TArray<FName> SoundTags = { TEXT("CompressionQuality"), TEXT("SoundGroup"), TEXT("bLooping"), TEXT("bStreaming"), TEXT("LoadingBehavior"),
+        TEXT("SampleRate"), TEXT("Channels"), TEXT("Duration") };
+    static const TArray<FName> NoTags;
+
+    if (Class == nullptr) return NoTags;
+    if (Class->IsChildOf(UTexture::StaticClass())) return TextureTags;
+    if (Class->IsChildOf(UStaticMesh::StaticClass())) return StaticMeshTags;
+    if (Class->IsChildOf(USkeletalMesh::StaticClass())) return SkeletalMeshTags;
+    if (Class->IsChildOf(USoundWave::StaticClass())) return SoundTags;
+    return NoTags;
+}
+
+FString AssetActionDuplicateCheck::GetSettings(const FAssetData& Asset, UClass* Class)
+{
+    FString Settings;
+    for (const FName& Tag : GetSettingTags(Class))
+    {
+        FString Value;
+        Asset.GetTagValue(Tag, Value);
+        Settings += Value + TEXT("\n");
+    }
+
+    return Settings;
+}
+
+bool AssetActionDuplicateCheck::IsVariantResult(FName Result)
+{
+    return Result.GetNumber() != NAME_NO_NUMBER_INTERNAL && Result.GetPlainNameString().Equals(DUPLICATE_VARIANT_RESULT);
+}
+
+bool AssetActionDuplicateCheck::EstimateImpact(const TArray<FAssetData>& Assets, FAssetActionImpact& OutImpact)
+{
+    AssetManager* manager = AssetManager::Get();
+    if (manager == nullptr) return false;
+
+    const AssetDependencyGraph& Graph = manager->GetDependencyGraph();
+
+    TArray<FName> PackageNames;
+    for (const FAssetData& Asset : Assets)
+    {
+        if (DuplicateOf.Contains(Asset.PackageName)) PackageNames.Add(Asset.PackageName);
+    }
+
+    // Referencers of the duplicates are resaved pointing at the originals, the duplicates are deleted
+    int64 ReferencerSize = 0;
+    OutImpact.ReferencersTouched = Graph.CountReferencers(PackageNames, ReferencerSize);
+    OutImpact.ResavedPackages = OutImpact.ReferencersTouched;
+    OutImpact.DeletedPackages = PackageNames.Num();
+    OutImpact.BytesWritten = ReferencerSize;
+    OutImpact.BytesDeleted = Graph.GetTotalSize(PackageNames);
+
+    return true;
+}
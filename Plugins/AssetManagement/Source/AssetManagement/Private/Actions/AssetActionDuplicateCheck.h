@@ -0,0 +1,33 @@
+#pragma once
+#include "AssetAction.h"
+
+class AssetActionDuplicateCheck : public IAssetAction
+{
+public:
+    void ScanAssets(TArray<FAssetInfo>& Assets, uint16 AssignedId) override;
+    void ExecuteAction(TArray<FAssetData> Assets) override;
+    FString GetTooltipHeading() override { return "Duplicate asset"; }
+    FString GetTooltipContent() override { return "The source data of this asset is identical to another asset.\n\n{Asset}"; }
+    FString GetFilterName() override { return "Duplicate assets"; }
+    FString GetApplyAllTag() override { return "Merge all duplicates"; }
+    FString GetButtonStyleName() override { return "Action.Duplicate"; }
+    uint32 GetRequirements() override { return AAR_RegistryTags | AAR_Dependencies | AAR_PackageFiles; }
+    EAssetActionGranularity GetGranularity() override { return AAG_WholeGraph; }
+    bool EstimateImpact(const TArray<FAssetData>& Assets, FAssetActionImpact& OutImpact) override;
+    // Results are the package to merge into, or a variant id for copies of the same source imported with different settings
+    FString FormatResult(FName Result) override;
+    bool CanExecute(FName Result) override { return !IsVariantResult(Result); }
+
+private:
+    bool IsCandidate(UClass* Class);
+
+    // Registry tags of the import settings that change how the asset renders or sounds, merging copies that differ in them changes the game
+    static const TArray<FName>& GetSettingTags(UClass* Class);
+    static FString GetSettings(const FAssetData& Asset, UClass* Class);
+    static bool IsVariantResult(FName Result);
+
+    // Maps every duplicate package onto the asset it should be merged into
+    TMap<FName, FAssetData> DuplicateOf;
+    // Copies of the same source with different settings, one asset per distinct set of settings. Only reported, never merged
+    TArray<TArray<FAssetData>> Variants;
+};
@@ -1,378 +1,691 @@
-#include "AssetActionNamingCheck.h"
-
-#include "AssetMagementConfig.h"
-#include "AssetMagementCore.h"
-#include "ObjectTools.h"
-#include "Framework/Notifications/NotificationManager.h"
-#include "Widgets/Notifications/SNotificationList.h"
-#include "FileHelpers.h"
-#include "ISourceControlModule.h"
-#include "Dom/JsonValue.h"
-#include "JsonSerializer.h"
-#include "JsonWriter.h"
-
-#include "Materials/Material.h"
-#include "Materials/MaterialInstanceConstant.h"
-#include "Engine/UserDefinedEnum.h"
-#include "Engine/UserDefinedStruct.h"
-#include "AssetToolsModule.h"
-#include "WidgetBlueprint.h"
-#include "Animation/AnimBlueprint.h"
-#include "Animation/BlendSpace.h"
-#include "Animation/BlendSpace1D.h"
-#include "Animation/Rig.h"
-#include "Engine/TextureRenderTarget2D.h"
-#include "Engine/TextureRenderTargetCube.h"
-#include "Particles/ParticleSystem.h"
-
-AssetActionNamingCheck::AssetActionNamingCheck()
-{
-    OnConfigChanged();
-    OnConfigChangedHandle = AssetManagerConfig::OnConfigChanged.AddRaw(this, &AssetActionNamingCheck::OnConfigChanged);
-}
-
-AssetActionNamingCheck::~AssetActionNamingCheck()
-{
-    AssetManagerConfig::OnConfigChanged.Remove(OnConfigChangedHandle);
-}
-
-void AssetActionNamingCheck::OnConfigChanged()
-{
-    FString JsonData = AssetManagerConfig::Get().GetString("Actions", "NamingPatterns", "");
-    if (!JsonData.IsEmpty())
-    {
-        NamingPatterns = JsonToNamingPatterns(JsonData);
-    }
-    else
-    {
-        NamingPatterns = GetDefaultPatterns();
-        JsonData = NamingPatternsToJson(NamingPatterns);
-        AssetManagerConfig::Get().SetString("Actions", "NamingPatterns", JsonData);
-        AssetManagerConfig::OnConfigChanged.Broadcast();
-    }
-
-    NamingPatterns.Sort([](const FNamingPattern& A, const FNamingPattern& B)
-    {
-        return A.Class->IsChildOf(B.Class);
-    });
-
-    AssetManager* manager = AssetManager::Get();
-    if (manager != nullptr)
-    {
-        manager->Get()->RequestRescan();
-    }
-}
-
-void AssetActionNamingCheck::ScanAssets(TArray<FAssetInfo>& Assets, uint16 AssignedId)
-{
-    for (FAssetInfo& Asset : Assets)
-    {
-        FString name = Asset.Data.AssetName.ToString();
-        FString suggested_name = GetNameForAsset(name, Asset.Data.GetClass(), Asset.Data.GetAsset());
-        
-        if(!name.Equals(suggested_name))
-        {
-            Asset.ActionResults.Add(AssignedId, suggested_name);
-        }
-    }
-}
-
-void AssetActionNamingCheck::ExecuteAction(TArray<FAssetData> Assets)
-{
-    for (FAssetData& Asset : Assets) 
-    {
-        FString name = Asset.AssetName.ToString();
-        FString suggested_name = GetNameForAsset(name, Asset.GetClass(), Asset.GetAsset());
-
-        if (!name.Equals(suggested_name))
-        {
-            TArray<UPackage*> FilesToSave;
-            
-            TSet<UPackage*> ObjectsUserRefusedToFullyLoad;
-            FText ErrorMessage;
-
-            ObjectTools::FPackageGroupName PGN;
-            PGN.ObjectName = suggested_name;
-            PGN.GroupName = TEXT("");
-            PGN.PackageName = Asset.PackagePath.ToString() / suggested_name;
-
-            UObject* Object = Asset.GetAsset();
-            UPackage* OldPackage = Object->GetOutermost();
-
-            bool WasRooted = false;
-            if(!OldPackage->IsRooted())
-            {
-                OldPackage->AddToRoot();
-                WasRooted = true;
-            }
-            
-            bool Result = ObjectTools::RenameSingleObject(Object, PGN, ObjectsUserRefusedToFullyLoad, ErrorMessage, nullptr, true);
-
-            if(!Result)
-            {
-                FNotificationInfo Notification(ErrorMessage);
-                Notification.ExpireDuration = 3.0f;
-                FSlateNotificationManager::Get().AddNotification(Notification);
-            }
-            else
-            {
-                FilesToSave.Add(Object->GetOutermost());
-                FilesToSave.Add(OldPackage);
-            }
-
-            if (WasRooted)
-            {
-                OldPackage->RemoveFromRoot();
-            }
-
-            if (FilesToSave.Num() > 0)
-            {
-                FEditorFileUtils::PromptForCheckoutAndSave(FilesToSave, false, false, nullptr, true);
-                ISourceControlModule::Get().QueueStatusUpdate(FilesToSave);
-            }
-
-            if (Result)
-            {
-                UObjectRedirector* Redirector = LoadObject<UObjectRedirector>(UObjectRedirector::StaticClass(), *Asset.PackageName.ToString());
-
-                if (Redirector != nullptr)
-                {
-                    FAssetToolsModule& AssetToolsModule = FModuleManager::LoadModuleChecked<FAssetToolsModule>(TEXT("AssetTools"));
-                    AssetToolsModule.Get().FixupReferencers({ Redirector });
-                }
-            }
-        }
-    }
-}
-
-#define NAMED_OBJECT(CLASS_NAME) TSoftClassPtr<UObject>(FSoftObjectPath(TEXT("/Script/" #CLASS_NAME))).Get()
-#define STATIC_OBJECT(CLASS_NAME) CLASS_NAME::StaticClass()
-
-#define DEF_BASEBEG(CLASS) Patterns.Add({ CLASS
-#define DEF_BASEEND() })
-#define DEF_PREFIX(CLASS, PREFIX) DEF_BASEBEG(CLASS), {}, PREFIX, "" DEF_BASEEND()
-#define DEF_SUFFIX(CLASS, SUFFIX) DEF_BASEBEG(CLASS), {}, "", SUFFIX DEF_BASEEND()
-#define DEF_PREFIX_SUFFIX(CLASS, PREFIX, SUFFIX) DEF_BASEBEG(CLASS), {}, PREFIX, SUFFIX DEF_BASEEND()
-
-TArray<FNamingPattern> AssetActionNamingCheck::GetDefaultPatterns()
-{
-    TArray<FNamingPattern> Patterns;
-
-    DEF_PREFIX(STATIC_OBJECT(UBlueprint), "BP_");
-    Patterns.Add({ UBlueprint::StaticClass(), {{ "BlueprintType", EClassPropertyType::CPT_Byte, FString::FromInt(EBlueprintType::BPTYPE_FunctionLibrary) }}, "BPFL_", "" });
-    Patterns.Add({ UBlueprint::StaticClass(), {{ "BlueprintType", EClassPropertyType::CPT_Byte, FString::FromInt(EBlueprintType::BPTYPE_Interface) }}, "BPI_", "" });
-    Patterns.Add({ UBlueprint::StaticClass(), {{ "BlueprintType", EClassPropertyType::CPT_Byte, FString::FromInt(EBlueprintType::BPTYPE_MacroLibrary) }}, "BPML_", "" });
-    DEF_PREFIX(STATIC_OBJECT(UAnimBlueprint), "ABP_");
-    DEF_PREFIX(STATIC_OBJECT(UWidgetBlueprint), "WBP_");
-
-    DEF_PREFIX(STATIC_OBJECT(UUserDefinedStruct), "F");
-    DEF_PREFIX(STATIC_OBJECT(UUserDefinedEnum), "E");
-
-    DEF_PREFIX(STATIC_OBJECT(UMaterialInstanceConstant), "MI_");
-    DEF_PREFIX(STATIC_OBJECT(UMaterial), "M_");
-    
-    DEF_PREFIX(STATIC_OBJECT(UStaticMesh), "SM_");
-    DEF_PREFIX(STATIC_OBJECT(USkeletalMesh), "SK_");
-
-    DEF_PREFIX(STATIC_OBJECT(UTexture), "T_");
-    DEF_PREFIX(STATIC_OBJECT(UTextureRenderTarget2D), "RT_");
-    DEF_PREFIX(STATIC_OBJECT(UTextureRenderTargetCube), "RTC_");
-    DEF_PREFIX(NAMED_OBJECT(MediaAssets.MediaTexture), "MT_");
-    DEF_PREFIX(NAMED_OBJECT(MediaAssets.MediaPlayer), "MP_");
-
-    DEF_PREFIX(STATIC_OBJECT(UParticleSystem), "PS_");
-
-    DEF_PREFIX(NAMED_OBJECT(Engine.AimOffsetBlendSpace), "AO_");
-    DEF_PREFIX(NAMED_OBJECT(Engine.AimOffsetBlendSpace1D), "AO_");
-    DEF_PREFIX(NAMED_OBJECT(Engine.AnimComposite), "AC_");
-    DEF_PREFIX(NAMED_OBJECT(Engine.AnimMontage), "AM_");
-    DEF_PREFIX(NAMED_OBJECT(Engine.AnimSequence), "A_");
-    DEF_PREFIX(STATIC_OBJECT(UBlendSpace), "BS_");
-    DEF_PREFIX(STATIC_OBJECT(UBlendSpace1D), "BS_");
-
-    DEF_PREFIX(STATIC_OBJECT(URig), "Rig_");
-    DEF_PREFIX(STATIC_OBJECT(USkeleton), "Skel_");
-
-    DEF_PREFIX(NAMED_OBJECT(Engine.Font), "Font_");
-    
-    return Patterns;
-}
-
-FString AssetActionNamingCheck::NamingPatternsToJson(const TArray<FNamingPattern>& Patterns)
-{
-    if (Patterns.Num() == 0)
-    {
-        return "";
-    }
-
-    TArray<TSharedPtr<FJsonValue>> PatternValues;
-    for(const FNamingPattern& Pattern : Patterns)
-    {
-        TSharedPtr<FJsonObject> Object = MakeShareable(new FJsonObject);
-        Object->SetStringField("Class", Pattern.Class->GetPathName());
-        Object->SetStringField("Prefix", Pattern.Prefix);
-        Object->SetStringField("Suffix", Pattern.Suffix);
-
-        TArray<TSharedPtr<FJsonValue>> PropertyList;
-        for (const FPropertyFilter& Filter : Pattern.ClassProperties)
-        {
-            TSharedPtr<FJsonObject> FilterObject = MakeShareable(new FJsonObject);
-            FilterObject->SetStringField("Property", Filter.PropertyName);
-            FilterObject->SetNumberField("Type", (int)Filter.PropertyType);
-            FilterObject->SetStringField("Value", Filter.ExpectedValue);
-            PropertyList.Add(MakeShareable(new FJsonValueObject(FilterObject)));
-        }
-        Object->SetArrayField("Properties", PropertyList);
-
-        PatternValues.Add(MakeShareable(new FJsonValueObject(Object)));
-    }
-
-    TSharedRef<FJsonObject> RootObject = MakeShareable(new FJsonObject);
-    RootObject->SetArrayField("Patterns", PatternValues);
-    
-    FString OutputString;
-    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
-    FJsonSerializer::Serialize(RootObject, Writer);
-    
-    return OutputString;
-}
-
-TArray<FNamingPattern> AssetActionNamingCheck::JsonToNamingPatterns(const FString& InputString)
-{
-    TArray<FNamingPattern> Patterns = {};
-    
-    TSharedPtr<FJsonObject> RootObject;
-    
-    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(InputString);
-    FJsonSerializer::Deserialize(Reader, RootObject);
-
-    if (RootObject.IsValid())
-    {
-        TArray<TSharedPtr<FJsonValue>> Array = RootObject->GetArrayField("Patterns");
-        for(TSharedPtr<FJsonValue>& Value : Array)
-        {
-            const TSharedPtr<FJsonObject>* Object;
-            if (Value->TryGetObject(Object))
-            {
-                FString ClassName, Prefix, Suffix;
-                TArray<FPropertyFilter> PropertyFilters;
-                
-                Object->Get()->TryGetStringField("Class", ClassName);
-                Object->Get()->TryGetStringField("Prefix", Prefix);
-                Object->Get()->TryGetStringField("Suffix", Suffix);
-
-                const TArray<TSharedPtr<FJsonValue>>* FilterArray;
-                if (Object->Get()->TryGetArrayField("Properties", FilterArray))
-                {
-                    for (TSharedPtr<FJsonValue> Filter : (*FilterArray))
-                    {
-                        const TSharedPtr<FJsonObject>* FilterObject;
-                        if (Filter->TryGetObject(FilterObject))
-                        {
-                            FString PropertyName, ExpectedValue;
-                            int Type;
-                            FilterObject->Get()->TryGetStringField("Property", PropertyName);
-                            FilterObject->Get()->TryGetNumberField("Type", Type);
-                            FilterObject->Get()->TryGetStringField("Value", ExpectedValue);
-
-                            if (!PropertyName.IsEmpty() && !ExpectedValue.IsEmpty())
-                            {
-                                PropertyFilters.Add({ PropertyName, static_cast<EClassPropertyType>(Type), ExpectedValue });
-                            }
-                        }
-                    }
-                }
-
-                UClass* Class = nullptr;
-                if (!ClassName.IsEmpty()) Class = LoadClass<UObject>(nullptr, *ClassName);
-
-                if (Class != nullptr)
-                {
-                    Patterns.Add({ Class, PropertyFilters, Prefix, Suffix });
-                }
-            }
-        }
-    }
-    
-    return Patterns;
-}
-
-#if ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION < 26
-    #define FindPropertyValue(PropType, TargetVar, PropClass, PropName, PropObject) U##PropType##Property* Prop = FindField<U##PropType##Property>(PropClass, PropName); if (Prop != nullptr) { TargetVar = Prop->GetPropertyValue_InContainer(PropObject); }
-#else
-    #define FindPropertyValue(PropType, TargetVar, PropClass, PropName, PropObject) F##PropType##Property* Prop = FindFProperty<F##PropType##Property>(PropClass, PropName); if (Prop != nullptr) { TargetVar = Prop->GetPropertyValue_InContainer(PropObject); }
-#endif
-
-FString GetObjectProperty(UClass* Class, UObject* Object, FString PropertyName, EClassPropertyType PropertyType)
-{
-    switch (PropertyType)
-    {
-        case EClassPropertyType::CPT_String:
-        {
-            FString Out = "";
-            FindPropertyValue(Str, Out, Class, *PropertyName, Object);
-            return Out;
-        }
-        case EClassPropertyType::CPT_Byte:
-        {
-            unsigned char Out = 0;
-            FindPropertyValue(Byte, Out, Class, *PropertyName, Object);
-            return FString::FromInt(Out);
-        }
-        case EClassPropertyType::CPT_Int32:
-        {
-            int32 Out = 0;
-            FindPropertyValue(Int, Out, Class, *PropertyName, Object);
-            return FString::FromInt(Out);
-        }
-        case EClassPropertyType::CPT_Float:
-        {
-            float Out = 0;
-            FindPropertyValue(Float, Out, Class, *PropertyName, Object);
-            return FString::SanitizeFloat(Out);
-        }
-    }
-
-    return "";
-}
-
-FString AssetActionNamingCheck::GetNameForAsset(FString Name, UClass* Class, UObject* Object)
-{
-    FNamingPattern* Pattern = nullptr;
-
-    for(FNamingPattern& Check : NamingPatterns)
-    {
-        if (Class == Check.Class || Class->IsChildOf(Check.Class))
-        {
-            bool Valid = true;
-
-            for( FPropertyFilter& PropertyFilter : Check.ClassProperties)
-            {
-                FString Value = GetObjectProperty(Class, Object, PropertyFilter.PropertyName, PropertyFilter.PropertyType);
-                if (Value != PropertyFilter.ExpectedValue)
-                {
-                    Valid = false;
-                    break;
-                }
-            }
-            
-            if (Valid) 
-            {
-                Pattern = &Check;
-                break;
-            }
-        }
-    }
-
-    if (Pattern == nullptr)
-    {
-        return Name;
-    }
-    else 
-    {
-        FString result = Name;
-        if (!Pattern->Prefix.IsEmpty() && !Name.Mid(0, Pattern->Prefix.Len()).Equals(Pattern->Prefix)) result = Pattern->Prefix + result;
-        if (!Pattern->Suffix.IsEmpty() && !Name.Mid(Name.Len() - Pattern->Suffix.Len()).Equals(Pattern->Suffix)) result = result + Pattern->Suffix;
-        return result;
-    }
-}
+#include "AssetActionNamingCheck.h"
+
+#include "AssetMagementConfig.h"
+#include "AssetMagementCore.h"
+#include "AssetManagementModule.h"
+#include "ObjectTools.h"
+#include "Framework/Notifications/NotificationManager.h"
+#include "Widgets/Notifications/SNotificationList.h"
+#include "FileHelpers.h"
+#include "ISourceControlModule.h"
+#include "AssetScanWorkers.h"
+#include "Dom/JsonValue.h"
+#include "JsonSerializer.h"
+#include "JsonWriter.h"
+
+#include "Materials/Material.h"
+#include "Materials/MaterialInstanceConstant.h"
+#include "Engine/UserDefinedEnum.h"
+#include "Engine/UserDefinedStruct.h"
+#include "AssetToolsModule.h"
+#include "WidgetBlueprint.h"
+#include "Animation/AnimBlueprint.h"
+#include "Animation/BlendSpace.h"
+#include "Animation/BlendSpace1D.h"
+#include "Animation/Rig.h"
+#include "Engine/TextureRenderTarget2D.h"
+#include "Engine/TextureRenderTargetCube.h"
+#include "Particles/ParticleSystem.h"
+
+#define NAMING_CHUNK_SIZE 512
+#define NAMING_YIELD_MASK 127
+#define NAMING_RULE_RESULT TEXT("NamingRuleViolation")
+#define NAMING_RULE_BITS 16
+
+AssetActionNamingCheck::AssetActionNamingCheck()
+{
+    OnConfigChanged();
+    OnConfigChangedHandle = AssetManagerConfig::OnConfigChanged.AddRaw(this, &AssetActionNamingCheck::OnConfigChanged);
+}
+
+AssetActionNamingCheck::~AssetActionNamingCheck()
+{
+    AssetManagerConfig::OnConfigChanged.Remove(OnConfigChangedHandle);
+}
+
+void AssetActionNamingCheck::OnConfigChanged()
+{
+    FString JsonData = AssetManagerConfig::Get().GetString("Actions", "NamingPatterns", "");
+    if (!JsonData.IsEmpty())
+    {
+        NamingPatterns = JsonToNamingPatterns(JsonData);
+    }
+    else
+    {
+        NamingPatterns = GetDefaultPatterns();
+        JsonData = NamingPatternsToJson(NamingPatterns);
+        AssetManagerConfig::Get().SetString("Actions", "NamingPatterns", JsonData);
+        AssetManagerConfig::OnConfigChanged.Broadcast();
+    }
+
+    ConfigFingerprint = FCrc::StrCrc32(*JsonData);
+    RenameViolations.Empty();
+
+    // Subclasses first, patterns of the same class keep their order so filtered variants stay ahead of the plain one
+    NamingPatterns.StableSort([](const FNamingPattern& A, const FNamingPattern& B)
+    {
+        return A.Class != B.Class && A.Class->IsChildOf(B.Class);
+    });
+
+    NamingRules.Empty();
+    FilterTags.Empty();
+    FiltersOnObjects = false;
+    for (const FNamingPattern& Pattern : NamingPatterns)
+    {
+        TArray<FString> Expressions;
+        for (const FNamingRule& Rule : Pattern.Rules)
+        {
+            Expressions.Add(GetRuleExpression(Rule));
+        }
+
+        NamingRules[NamingRules.AddDefaulted()].Build(Expressions);
+
+        TArray<FName>& Tags = FilterTags[FilterTags.AddDefaulted()];
+        for (const FPropertyFilter& Filter : Pattern.ClassProperties)
+        {
+            Tags.Add(Filter.Source == EPropertyFilterSource::PFS_AssetRegistryTag ? FName(*Filter.PropertyName) : NAME_None);
+            FiltersOnObjects |= Filter.Source == EPropertyFilterSource::PFS_Object;
+        }
+    }
+}
+
+void AssetActionNamingCheck::ScanAssets(TArray<FAssetInfo>& Assets, uint16 AssignedId)
+{
+    // Class lookups search the object hash, which is only safe on the game thread
+    TArray<UClass*> Classes;
+    Classes.SetNumUninitialized(Assets.Num());
+    for (int32 i = 0; i < Assets.Num(); i++)
+    {
+        Classes[i] = Assets[i].Data.GetClass();
+    }
+
+    AssetManager* manager = AssetManager::Get();
+    const int32 NumChunks = FMath::DivideAndRoundUp(Assets.Num(), NAMING_CHUNK_SIZE);
+
+    TArray<TArray<TPair<int32, FNamingResult>>> ChunkResults;
+    TArray<TArray<int32>> ChunkDeferred;
+    ChunkResults.SetNum(NumChunks);
+    ChunkDeferred.SetNum(NumChunks);
+
+    // Names, tags and rules are plain data, every chunk only writes to its own buffers
+    AssetScanWorkers::Get().ParallelFor(NumChunks, [&](int32 Chunk)
+    {
+        const int32 End = FMath::Min((Chunk + 1) * NAMING_CHUNK_SIZE, Assets.Num());
+        for (int32 i = Chunk * NAMING_CHUNK_SIZE; i < End; i++)
+        {
+            if ((i & NAMING_YIELD_MASK) == 0) AssetScanWorkers::YieldPoint();
+            if (Classes[i] == nullptr || Assets[i].IsSuppressed(AssignedId)) continue;
+
+            FNamingResult Result;
+            if (!GetResult(Assets[i].Data, Classes[i], nullptr, Result)) ChunkDeferred[Chunk].Add(i);
+            else if (!Result.Result.IsNone()) ChunkResults[Chunk].Add(TPair<int32, FNamingResult>(i, Result));
+        }
+    });
+
+    for (int32 Chunk = 0; Chunk < NumChunks; Chunk++)
+    {
+        for (TPair<int32, FNamingResult>& Result : ChunkResults[Chunk])
+        {
+            AddResult(Assets[Result.Key], AssignedId, Result.Value);
+        }
+
+        // Assets filtered on object properties are checked once the manager has loaded them in batches
+        for (int32 i : ChunkDeferred[Chunk])
+        {
+            UClass* Class = Classes[i];
+            auto OnLoaded = [this, &Assets, i, Class, AssignedId](UObject* Object)
+            {
+                FNamingResult Result;
+                if (Object == nullptr || !GetResult(Assets[i].Data, Class, Object, Result)) return;
+                if (!Result.Result.IsNone()) AddResult(Assets[i], AssignedId, Result);
+            };
+
+            if (manager != nullptr) manager->GetLoader().Request(Assets[i].Data, OnLoaded);
+            else OnLoaded(Assets[i].Data.GetAsset());
+        }
+    }
+}
+
+uint32 AssetActionNamingCheck::GetRequirements()
+{
+    // Objects are only loaded when a pattern filters on an object property
+    return FiltersOnObjects ? AAR_RegistryTags | AAR_LoadedObjects : AAR_RegistryTags;
+}
+
+bool AssetActionNamingCheck::GetCacheInputs(const FAssetData& Asset, FString& OutInputs)
+{
+    // Besides the name only the class and the filtered tags are read
+    OutInputs = Asset.AssetClass.ToString();
+    for (const TArray<FName>& Tags : FilterTags)
+    {
+        for (const FName& Tag : Tags)
+        {
+            FString Value;
+            if (!Tag.IsNone() && Asset.GetTagValue(Tag, Value)) OutInputs += TEXT("\n") + Tag.ToString() + TEXT("=") + Value;
+        }
+    }
+
+    return FiltersOnObjects;
+}
+
+int32 AssetActionNamingCheck::GetResultDetail(FName Result)
+{
+    const int32* Violation = RenameViolations.Find(Result);
+    return Violation != nullptr ? *Violation : INDEX_NONE;
+}
+
+void AssetActionNamingCheck::RestoreResultDetail(FName Result, int32 Detail)
+{
+    if (Detail != INDEX_NONE && !IsRuleResult(Result)) RenameViolations.Add(Result, Detail);
+}
+
+bool AssetActionNamingCheck::EstimateImpact(const TArray<FAssetData>& Assets, FAssetActionImpact& OutImpact)
+{
+    AssetManager* manager = AssetManager::Get();
+    if (manager == nullptr) return false;
+
+    const AssetDependencyGraph& Graph = manager->GetDependencyGraph();
+
+    TArray<FName> PackageNames;
+    for (const FAssetData& Asset : Assets)
+    {
+        PackageNames.Add(Asset.PackageName);
+    }
+
+    // A rename saves the new package and a redirector, fixing the redirector resaves the referencers and deletes it again
+    int64 ReferencerSize = 0;
+    OutImpact.ReferencersTouched = Graph.CountReferencers(PackageNames, ReferencerSize);
+    OutImpact.ResavedPackages = PackageNames.Num() + OutImpact.ReferencersTouched;
+    OutImpact.DeletedPackages = PackageNames.Num();
+    OutImpact.BytesWritten = Graph.GetTotalSize(PackageNames) + ReferencerSize;
+
+    return true;
+}
+
+bool AssetActionNamingCheck::GetResult(const FAssetData& Asset, UClass* Class, UObject* Object, FNamingResult& OutResult) const
+{
+    int32 PatternIndex = INDEX_NONE;
+    if (!FindPattern(Asset, Class, Object, false, PatternIndex)) return false;
+
+    OutResult = FNamingResult();
+    if (PatternIndex == INDEX_NONE) return true;
+
+    const FString Name = Asset.AssetName.ToString();
+    const FString SuggestedName = ApplyPattern(PatternIndex, Name, &OutResult.Violation);
+
+    // Names that only break a rule can't be fixed by renaming, the number of the fixed name carries the rule id
+    if (!Name.Equals(SuggestedName)) OutResult.Result = FName(*SuggestedName);
+    else if (OutResult.Violation != INDEX_NONE) OutResult.Result = FName(NAMING_RULE_RESULT, OutResult.Violation + 1);
+
+    return true;
+}
+
+void AssetActionNamingCheck::AddResult(FAssetInfo& Asset, uint16 AssignedId, const FNamingResult& Result)
+{
+    Asset.ActionResults.Add(AssignedId, Result.Result);
+    if (Result.Violation != INDEX_NONE && !IsRuleResult(Result.Result)) RenameViolations.Add(Result.Result, Result.Violation);
+}
+
+bool AssetActionNamingCheck::IsRuleResult(FName Result)
+{
+    return Result.GetNumber() != NAME_NO_NUMBER_INTERNAL && Result.GetPlainNameString().Equals(NAMING_RULE_RESULT);
+}
+
+FString AssetActionNamingCheck::FormatResult(FName Result)
+{
+    if (IsRuleResult(Result))
+    {
+        return GetViolationDescription(Result.GetNumber() - 1) + "\n\nRenaming can't fix this, rename the asset by hand";
+    }
+
+    FString Text = "Suggested asset name: " + Result.ToString();
+
+    const int32* Violation = RenameViolations.Find(Result);
+    if (Violation != nullptr) Text += "\n" + GetViolationDescription(*Violation);
+
+    return Text + "\n\nClick to apply naming";
+}
+
+FString AssetActionNamingCheck::GetViolationDescription(int32 Violation) const
+{
+    const int32 PatternIndex = Violation >> NAMING_RULE_BITS;
+    const int32 RuleIndex = Violation & ((1 << NAMING_RULE_BITS) - 1);
+
+    // Ids from the index of an older configuration may not exist any more
+    if (!NamingPatterns.IsValidIndex(PatternIndex) || !NamingPatterns[PatternIndex].Rules.IsValidIndex(RuleIndex)) return "Breaks a naming rule";
+
+    return GetRuleDescription(NamingPatterns[PatternIndex].Rules[RuleIndex]);
+}
+
+void AssetActionNamingCheck::ExecuteAction(TArray<FAssetData> Assets)
+{
+    for (FAssetData& Asset : Assets) 
+    {
+        FString name = Asset.AssetName.ToString();
+        FString suggested_name = GetNameForAsset(Asset);
+
+        if (!name.Equals(suggested_name))
+        {
+            TArray<UPackage*> FilesToSave;
+            
+            TSet<UPackage*> ObjectsUserRefusedToFullyLoad;
+            FText ErrorMessage;
+
+            ObjectTools::FPackageGroupName PGN;
+            PGN.ObjectName = suggested_name;
+            PGN.GroupName = TEXT("");
+            PGN.PackageName = Asset.PackagePath.ToString() / suggested_name;
+
+            UObject* Object = Asset.GetAsset();
+            UPackage* OldPackage = Object->GetOutermost();
+
+            bool WasRooted = false;
+            if(!OldPackage->IsRooted())
+            {
+                OldPackage->AddToRoot();
+                WasRooted = true;
+            }
+            
+            bool Result = ObjectTools::RenameSingleObject(Object, PGN, ObjectsUserRefusedToFullyLoad, ErrorMessage, nullptr, true);
+
+            if(!Result)
+            {
+                FNotificationInfo Notification(ErrorMessage);
+                Notification.ExpireDuration = 3.0f;
+                FSlateNotificationManager::Get().AddNotification(Notification);
+            }
+            else
+            {
+                FilesToSave.Add(Object->GetOutermost());
+                FilesToSave.Add(OldPackage);
+            }
+
+            if (WasRooted)
+            {
+                OldPackage->RemoveFromRoot();
+            }
+
+            if (FilesToSave.Num() > 0)
+            {
+                FEditorFileUtils::PromptForCheckoutAndSave(FilesToSave, false, false, nullptr, true);
+                ISourceControlModule::Get().QueueStatusUpdate(FilesToSave);
+            }
+
+            if (Result)
+            {
+                UObjectRedirector* Redirector = LoadObject<UObjectRedirector>(UObjectRedirector::StaticClass(), *Asset.PackageName.ToString());
+
+                if (Redirector != nullptr)
+                {
+                    FAssetToolsModule& AssetToolsModule = FModuleManager::LoadModuleChecked<FAssetToolsModule>(TEXT("AssetTools"));
+                    AssetToolsModule.Get().FixupReferencers({ Redirector });
+                }
+            }
+        }
+    }
+}
+
+#define NAMED_OBJECT(CLASS_NAME) TSoftClassPtr<UObject>(FSoftObjectPath(TEXT("/Script/" #CLASS_NAME))).Get()
+#define STATIC_OBJECT(CLASS_NAME) CLASS_NAME::StaticClass()
+
+#define DEF_BASEBEG(CLASS) Patterns.Add({ CLASS
+#define DEF_BASEEND() })
+#define DEF_PREFIX(CLASS, PREFIX) DEF_BASEBEG(CLASS), {}, PREFIX, "" DEF_BASEEND()
+#define DEF_SUFFIX(CLASS, SUFFIX) DEF_BASEBEG(CLASS), {}, "", SUFFIX DEF_BASEEND()
+#define DEF_PREFIX_SUFFIX(CLASS, PREFIX, SUFFIX) DEF_BASEBEG(CLASS), {}, PREFIX, SUFFIX DEF_BASEEND()
+
+TArray<FNamingPattern> AssetActionNamingCheck::GetDefaultPatterns()
+{
+    TArray<FNamingPattern> Patterns;
+
+    DEF_PREFIX(STATIC_OBJECT(UBlueprint), "BP_");
+    Patterns.Add({ UBlueprint::StaticClass(), {{ "BlueprintType", EClassPropertyType::CPT_Byte, FString::FromInt(EBlueprintType::BPTYPE_FunctionLibrary) }}, "BPFL_", "" });
+    Patterns.Add({ UBlueprint::StaticClass(), {{ "BlueprintType", EClassPropertyType::CPT_Byte, FString::FromInt(EBlueprintType::BPTYPE_Interface) }}, "BPI_", "" });
+    Patterns.Add({ UBlueprint::StaticClass(), {{ "BlueprintType", EClassPropertyType::CPT_Byte, FString::FromInt(EBlueprintType::BPTYPE_MacroLibrary) }}, "BPML_", "" });
+    DEF_PREFIX(STATIC_OBJECT(UAnimBlueprint), "ABP_");
+    DEF_PREFIX(STATIC_OBJECT(UWidgetBlueprint), "WBP_");
+
+    DEF_PREFIX(STATIC_OBJECT(UUserDefinedStruct), "F");
+    DEF_PREFIX(STATIC_OBJECT(UUserDefinedEnum), "E");
+
+    DEF_PREFIX(STATIC_OBJECT(UMaterialInstanceConstant), "MI_");
+    DEF_PREFIX(STATIC_OBJECT(UMaterial), "M_");
+    
+    DEF_PREFIX(STATIC_OBJECT(UStaticMesh), "SM_");
+    DEF_PREFIX(STATIC_OBJECT(USkeletalMesh), "SK_");
+
+    Patterns.Add({ UTexture::StaticClass(), {{ "CompressionSettings", EClassPropertyType::CPT_String, "TC_Normalmap", EPropertyFilterSource::PFS_AssetRegistryTag }}, "T_", "_N" });
+    Patterns.Add({ UTexture::StaticClass(), {{ "CompressionSettings", EClassPropertyType::CPT_String, "TC_Masks", EPropertyFilterSource::PFS_AssetRegistryTag }}, "T_", "_ORM" });
+    Patterns.Add({ UTexture::StaticClass(), {}, "T_", "", {{ ENamingRuleType::NRT_Glob, "T_*_{D,N,R,M,H,E,A,S,AO,ORM,MRA,Mask}" }} });
+    DEF_PREFIX(STATIC_OBJECT(UTextureRenderTarget2D), "RT_");
+    DEF_PREFIX(STATIC_OBJECT(UTextureRenderTargetCube), "RTC_");
+    DEF_PREFIX(NAMED_OBJECT(MediaAssets.MediaTexture), "MT_");
+    DEF_PREFIX(NAMED_OBJECT(MediaAssets.MediaPlayer), "MP_");
+
+    DEF_PREFIX(STATIC_OBJECT(UParticleSystem), "PS_");
+
+    DEF_PREFIX(NAMED_OBJECT(Engine.AimOffsetBlendSpace), "AO_");
+    DEF_PREFIX(NAMED_OBJECT(Engine.AimOffsetBlendSpace1D), "AO_");
+    DEF_PREFIX(NAMED_OBJECT(Engine.AnimComposite), "AC_");
+    DEF_PREFIX(NAMED_OBJECT(Engine.AnimMontage), "AM_");
+    DEF_PREFIX(NAMED_OBJECT(Engine.AnimSequence), "A_");
+    DEF_PREFIX(STATIC_OBJECT(UBlendSpace), "BS_");
+    DEF_PREFIX(STATIC_OBJECT(UBlendSpace1D), "BS_");
+
+    DEF_PREFIX(STATIC_OBJECT(URig), "Rig_");
+    DEF_PREFIX(STATIC_OBJECT(USkeleton), "Skel_");
+
+    DEF_PREFIX(NAMED_OBJECT(Engine.Font), "Font_");
+    
+    return Patterns;
+}
+
+FString AssetActionNamingCheck::NamingPatternsToJson(const TArray<FNamingPattern>& Patterns)
+{
+    if (Patterns.Num() == 0)
+    {
+        return "";
+    }
+
+    TArray<TSharedPtr<FJsonValue>> PatternValues;
+    for(const FNamingPattern& Pattern : Patterns)
+    {
+        TSharedPtr<FJsonObject> Object = MakeShareable(new FJsonObject);
+        Object->SetStringField("Class", Pattern.Class->GetPathName());
+        Object->SetStringField("Prefix", Pattern.Prefix);
+        Object->SetStringField("Suffix", Pattern.Suffix);
+
+        TArray<TSharedPtr<FJsonValue>> RuleList;
+        for (const FNamingRule& Rule : Pattern.Rules)
+        {
+            TSharedPtr<FJsonObject> RuleObject = MakeShareable(new FJsonObject);
+            RuleObject->SetNumberField("Type", (int)Rule.Type);
+            RuleObject->SetStringField("Pattern", Rule.Pattern);
+            RuleList.Add(MakeShareable(new FJsonValueObject(RuleObject)));
+        }
+        Object->SetArrayField("Rules", RuleList);
+
+        TArray<TSharedPtr<FJsonValue>> PropertyList;
+        for (const FPropertyFilter& Filter : Pattern.ClassProperties)
+        {
+            TSharedPtr<FJsonObject> FilterObject = MakeShareable(new FJsonObject);
+            FilterObject->SetStringField("Property", Filter.PropertyName);
+            FilterObject->SetNumberField("Type", (int)Filter.PropertyType);
+            FilterObject->SetStringField("Value", Filter.ExpectedValue);
+            FilterObject->SetNumberField("Source", (int)Filter.Source);
+            PropertyList.Add(MakeShareable(new FJsonValueObject(FilterObject)));
+        }
+        Object->SetArrayField("Properties", PropertyList);
+
+        PatternValues.Add(MakeShareable(new FJsonValueObject(Object)));
+    }
+
+    TSharedRef<FJsonObject> RootObject = MakeShareable(new FJsonObject);
+    RootObject->SetArrayField("Patterns", PatternValues);
+    
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(RootObject, Writer);
+    
+    return OutputString;
+}
+
+TArray<FNamingPattern> AssetActionNamingCheck::JsonToNamingPatterns(const FString& InputString)
+{
+    TArray<FNamingPattern> Patterns = {};
+    
+    TSharedPtr<FJsonObject> RootObject;
+    
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(InputString);
+    FJsonSerializer::Deserialize(Reader, RootObject);
+
+    if (RootObject.IsValid())
+    {
+        TArray<TSharedPtr<FJsonValue>> Array = RootObject->GetArrayField("Patterns");
+        for(TSharedPtr<FJsonValue>& Value : Array)
+        {
+            const TSharedPtr<FJsonObject>* Object;
+            if (Value->TryGetObject(Object))
+            {
+                FString ClassName, Prefix, Suffix;
+                TArray<FPropertyFilter> PropertyFilters;
+                
+                Object->Get()->TryGetStringField("Class", ClassName);
+                Object->Get()->TryGetStringField("Prefix", Prefix);
+                Object->Get()->TryGetStringField("Suffix", Suffix);
+
+                const TArray<TSharedPtr<FJsonValue>>* FilterArray;
+                if (Object->Get()->TryGetArrayField("Properties", FilterArray))
+                {
+                    for (TSharedPtr<FJsonValue> Filter : (*FilterArray))
+                    {
+                        const TSharedPtr<FJsonObject>* FilterObject;
+                        if (Filter->TryGetObject(FilterObject))
+                        {
+                            FString PropertyName, ExpectedValue;
+                            int Type;
+                            int Source = 0;
+                            FilterObject->Get()->TryGetStringField("Property", PropertyName);
+                            FilterObject->Get()->TryGetNumberField("Type", Type);
+                            FilterObject->Get()->TryGetStringField("Value", ExpectedValue);
+                            FilterObject->Get()->TryGetNumberField("Source", Source);
+
+                            if (!PropertyName.IsEmpty() && !ExpectedValue.IsEmpty())
+                            {
+                                PropertyFilters.Add({ PropertyName, static_cast<EClassPropertyType>(Type), ExpectedValue, static_cast<EPropertyFilterSource>(Source) });
+                            }
+                        }
+                    }
+                }
+
+                TArray<FNamingRule> Rules;
+                const TArray<TSharedPtr<FJsonValue>>* RuleArray;
+                if (Object->Get()->TryGetArrayField("Rules", RuleArray))
+                {
+                    for (TSharedPtr<FJsonValue> Rule : (*RuleArray))
+                    {
+                        const TSharedPtr<FJsonObject>* RuleObject;
+                        if (Rule->TryGetObject(RuleObject))
+                        {
+                            FString Pattern;
+                            int Type = 0;
+                            RuleObject->Get()->TryGetNumberField("Type", Type);
+                            RuleObject->Get()->TryGetStringField("Pattern", Pattern);
+
+                            if (!Pattern.IsEmpty())
+                            {
+                                Rules.Add({ static_cast<ENamingRuleType>(Type), Pattern });
+                            }
+                        }
+                    }
+                }
+
+                UClass* Class = nullptr;
+                if (!ClassName.IsEmpty()) Class = LoadClass<UObject>(nullptr, *ClassName);
+
+                if (Class != nullptr)
+                {
+                    Patterns.Add({ Class, PropertyFilters, Prefix, Suffix, Rules });
+                }
+            }
+        }
+    }
+    
+    return Patterns;
+}
+
+#if ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION < 26
+    #define FindPropertyValue(PropType, TargetVar, PropClass, PropName, PropObject) U##PropType##Property* Prop = FindField<U##PropType##Property>(PropClass, PropName); if (Prop != nullptr) { TargetVar = Prop->GetPropertyValue_InContainer(PropObject); }
+#else
+    #define FindPropertyValue(PropType, TargetVar, PropClass, PropName, PropObject) F##PropType##Property* Prop = FindFProperty<F##PropType##Property>(PropClass, PropName); if (Prop != nullptr) { TargetVar = Prop->GetPropertyValue_InContainer(PropObject); }
+#endif
+
+FString GetObjectProperty(UClass* Class, UObject* Object, FString PropertyName, EClassPropertyType PropertyType)
+{
+    switch (PropertyType)
+    {
+        case EClassPropertyType::CPT_String:
+        {
+            FString Out = "";
+            FindPropertyValue(Str, Out, Class, *PropertyName, Object);
+            return Out;
+        }
+        case EClassPropertyType::CPT_Byte:
+        {
+            unsigned char Out = 0;
+            FindPropertyValue(Byte, Out, Class, *PropertyName, Object);
+            return FString::FromInt(Out);
+        }
+        case EClassPropertyType::CPT_Int32:
+        {
+            int32 Out = 0;
+            FindPropertyValue(Int, Out, Class, *PropertyName, Object);
+            return FString::FromInt(Out);
+        }
+        case EClassPropertyType::CPT_Float:
+        {
+            float Out = 0;
+            FindPropertyValue(Float, Out, Class, *PropertyName, Object);
+            return FString::SanitizeFloat(Out);
+        }
+    }
+
+    return "";
+}
+
+FString AssetActionNamingCheck::GetNameForAsset(const FAssetData& Asset)
+{
+    FString Name = Asset.AssetName.ToString();
+
+    UClass* Class = Asset.GetClass();
+    if (Class == nullptr) return Name;
+
+    UObject* Object = nullptr;
+    int32 PatternIndex = INDEX_NONE;
+    FindPattern(Asset, Class, Object, true, PatternIndex);
+
+    if (PatternIndex == INDEX_NONE) return Name;
+    return ApplyPattern(PatternIndex, Name, nullptr);
+}
+
+bool AssetActionNamingCheck::FindPattern(const FAssetData& Asset, UClass* Class, UObject*& Object, bool AllowLoad, int32& OutPattern) const
+{
+    OutPattern = INDEX_NONE;
+
+    for(int32 i = 0; i < NamingPatterns.Num(); i++)
+    {
+        const FNamingPattern& Check = NamingPatterns[i];
+        if (Class == Check.Class || Class->IsChildOf(Check.Class))
+        {
+            bool Valid = true;
+
+            for (int32 f = 0; f < Check.ClassProperties.Num(); f++)
+            {
+                const FPropertyFilter& PropertyFilter = Check.ClassProperties[f];
+
+                FString Value;
+                if (PropertyFilter.Source == EPropertyFilterSource::PFS_AssetRegistryTag)
+                {
+                    Asset.GetTagValue(FilterTags[i][f], Value);
+                }
+                else
+                {
+                    // Only loaded once a pattern actually filters on an object property
+                    if (Object == nullptr)
+                    {
+                        if (!AllowLoad) return false;
+                        Object = Asset.GetAsset();
+                    }
+
+                    if (Object != nullptr) Value = GetObjectProperty(Class, Object, PropertyFilter.PropertyName, PropertyFilter.PropertyType);
+                }
+
+                if (Value != PropertyFilter.ExpectedValue)
+                {
+                    Valid = false;
+                    break;
+                }
+            }
+            
+            if (Valid) 
+            {
+                OutPattern = i;
+                break;
+            }
+        }
+    }
+
+    return true;
+}
+
+FString AssetActionNamingCheck::ApplyPattern(int32 PatternIndex, const FString& Name, int32* OutViolation) const
+{
+    const FNamingPattern& Pattern = NamingPatterns[PatternIndex];
+    FString result = Name;
+
+    // Forbidden characters are the only rules that can be fixed automatically
+    for (const FNamingRule& Rule : Pattern.Rules)
+    {
+        if (Rule.Type != ENamingRuleType::NRT_ForbiddenCharacters) continue;
+
+        for (int32 i = 0; i < Rule.Pattern.Len(); i++)
+        {
+            result.ReplaceInline(*FString::Chr(Rule.Pattern[i]), TEXT(""), ESearchCase::CaseSensitive);
+        }
+    }
+
+    if (!Pattern.Prefix.IsEmpty() && !result.Mid(0, Pattern.Prefix.Len()).Equals(Pattern.Prefix)) result = Pattern.Prefix + result;
+    if (!Pattern.Suffix.IsEmpty() && !result.Mid(result.Len() - Pattern.Suffix.Len()).Equals(Pattern.Suffix)) result = result + Pattern.Suffix;
+
+    if (OutViolation != nullptr && NamingRules.IsValidIndex(PatternIndex))
+    {
+        const int32 Violation = NamingRules[PatternIndex].FindViolation(result);
+        if (Violation != INDEX_NONE) *OutViolation = (PatternIndex << NAMING_RULE_BITS) | Violation;
+    }
+
+    return result;
+}
+
+FString AssetActionNamingCheck::GetRuleExpression(const FNamingRule& Rule)
+{
+    switch (Rule.Type)
+    {
+    case ENamingRuleType::NRT_Glob:
+        return NamingRuleAutomaton::GlobToRegex(Rule.Pattern);
+    case ENamingRuleType::NRT_Regex:
+        return Rule.Pattern;
+    case ENamingRuleType::NRT_CaseStyle:
+        // Styles apply to every part between underscores, so prefixes and suffixes don't break them
+        if (Rule.Pattern.Equals("PascalCase", ESearchCase::IgnoreCase)) return "[A-Z0-9][A-Za-z0-9]*(_[A-Z0-9][A-Za-z0-9]*)*";
+        if (Rule.Pattern.Equals("lowercase", ESearchCase::IgnoreCase)) return "[a-z0-9_]*";
+        if (Rule.Pattern.Equals("UPPERCASE", ESearchCase::IgnoreCase)) return "[A-Z0-9_]*";
+        UE_LOG(AssetManagementLog, Warning, TEXT("Unknown naming case style '%s'"), *Rule.Pattern);
+        return ".*";
+    case ENamingRuleType::NRT_ForbiddenCharacters:
+    {
+        FString Expression = "[^";
+        for (int32 i = 0; i < Rule.Pattern.Len(); i++)
+        {
+            const TCHAR Char = Rule.Pattern[i];
+            if (Char == '\\' || Char == ']' || Char == '^' || Char == '-') Expression.AppendChar('\\');
+            Expression.AppendChar(Char);
+        }
+        return Expression + "]*";
+    }
+    }
+
+    return ".*";
+}
+
+FString AssetActionNamingCheck::GetRuleDescription(const FNamingRule& Rule)
+{
+    switch (Rule.Type)
+    {
+    case ENamingRuleType::NRT_Glob: return "Does not match " + Rule.Pattern;
+    case ENamingRuleType::NRT_Regex: return "Does not match " + Rule.Pattern;
+    case ENamingRuleType::NRT_CaseStyle: return "Not written in " + Rule.Pattern;
+    case ENamingRuleType::NRT_ForbiddenCharacters: return "Contains one of " + Rule.Pattern;
+    }
+
+    return "";
+}
@@ -1,75 +1,154 @@
-#pragma once
-#include "../AssetAction.h"
-#include "AssetActionNamingCheck.generated.h"
-
-UENUM()
-enum class EClassPropertyType : uint8
-{
-    CPT_String    UMETA(DisplayName = "String"),
-    CPT_Byte      UMETA(DisplayName = "Byte"),
-    CPT_Int32     UMETA(DisplayName = "Int32"),
-    CPT_Float     UMETA(DisplayName = "Float")
-};
-
-USTRUCT(BlueprintType)
-struct FPropertyFilter
-{
-    GENERATED_BODY();
-
-    UPROPERTY()
-    FString PropertyName;
-
-    UPROPERTY()
-    EClassPropertyType PropertyType;
-
-    UPROPERTY()
-    FString ExpectedValue;
-};
-
-USTRUCT(BlueprintType)
-struct FNamingPattern
-{
-    GENERATED_BODY();
-
-    UPROPERTY()
-    UClass* Class;
-
-    UPROPERTY()
-    TArray<FPropertyFilter> ClassProperties;
-
-    UPROPERTY()
-    FString Prefix;
-
-    UPROPERTY()
-    FString Suffix;
-};
-
-class AssetActionNamingCheck : public IAssetAction
-{
-public:
-    AssetActionNamingCheck();
-    ~AssetActionNamingCheck() override;
-    
-    void OnConfigChanged();
-    
-    void ScanAssets(TArray<FAssetInfo>& Assets, uint16 AssignedId) override;
-    void ExecuteAction(TArray<FAssetData> Assets) override;
-    FString GetTooltipHeading() override { return "Improper naming"; }
-    FString GetTooltipContent() override { return "The name of this asset does not follow the defined format.\nSuggested asset name: {Asset}.\n\nClick to apply naming"; }
-    FString GetFilterName() override { return "Naming conventions"; }
-    FString GetApplyAllTag() override { return "Apply all naming conventions"; }
-
-    FString GetButtonStyleName() override { return "Action.Naming"; }
-
-    static TArray<FNamingPattern> GetDefaultPatterns();
-
-    static FString NamingPatternsToJson(const TArray<FNamingPattern>&);
-    static TArray<FNamingPattern> JsonToNamingPatterns(const FString&);
-
-private:
-    TArray<FNamingPattern> NamingPatterns;
-
-    FString GetNameForAsset(FString Name, UClass* Class, UObject* Object);
-    
-    FDelegateHandle OnConfigChangedHandle;
-};
+#pragma once
+#include "AssetAction.h"
+#include "../NamingRuleAutomaton.h"
+#include "AssetActionNamingCheck.generated.h"
+
+UENUM()
+enum class EClassPropertyType : uint8
+{
+    CPT_String    UMETA(DisplayName = "String"),
+    CPT_Byte      UMETA(DisplayName = "Byte"),
+    CPT_Int32     UMETA(DisplayName = "Int32"),
+    CPT_Float     UMETA(DisplayName = "Float")
+};
+
+UENUM()
+enum class EPropertyFilterSource : uint8
+{
+    PFS_Object              UMETA(DisplayName = "Object property"),
+    PFS_AssetRegistryTag    UMETA(DisplayName = "Asset registry tag")
+};
+
+USTRUCT(BlueprintType)
+struct FPropertyFilter
+{
+    GENERATED_BODY();
+
+    UPROPERTY()
+    FString PropertyName;
+
+    UPROPERTY()
+    EClassPropertyType PropertyType;
+
+    UPROPERTY()
+    FString ExpectedValue;
+
+    // Registry tags are read from the scanned asset data, only object properties require loading the asset
+    UPROPERTY()
+    EPropertyFilterSource Source = EPropertyFilterSource::PFS_Object;
+};
+
+UENUM()
+enum class ENamingRuleType : uint8
+{
+    NRT_Glob                  UMETA(DisplayName = "Glob"),
+    NRT_Regex                 UMETA(DisplayName = "Regex"),
+    NRT_CaseStyle             UMETA(DisplayName = "Case style"),
+    NRT_ForbiddenCharacters   UMETA(DisplayName = "Forbidden characters")
+};
+
+USTRUCT(BlueprintType)
+struct FNamingRule
+{
+    GENERATED_BODY();
+
+    UPROPERTY(EditAnywhere)
+    ENamingRuleType Type;
+
+    // Glob or regex the whole name has to match, PascalCase, lowercase or UPPERCASE, or the characters that may not appear
+    UPROPERTY(EditAnywhere)
+    FString Pattern;
+};
+
+USTRUCT(BlueprintType)
+struct FNamingPattern
+{
+    GENERATED_BODY();
+
+    UPROPERTY()
+    UClass* Class;
+
+    UPROPERTY()
+    TArray<FPropertyFilter> ClassProperties;
+
+    UPROPERTY()
+    FString Prefix;
+
+    UPROPERTY()
+    FString Suffix;
+
+    UPROPERTY()
+    TArray<FNamingRule> Rules;
+};
+
+class AssetActionNamingCheck : public IAssetAction
+{
+public:
+    AssetActionNamingCheck();
+    ~AssetActionNamingCheck() override;
+    
+    void OnConfigChanged();
+    
+    void ScanAssets(TArray<FAssetInfo>& Assets, uint16 AssignedId) override;
+    void ExecuteAction(TArray<FAssetData> Assets) override;
+    FString GetTooltipHeading() override { return "Improper naming"; }
+    FString GetTooltipContent() override { return "The name of this asset does not follow the defined format.\n{Asset}"; }
+    FString GetFilterName() override { return "Naming conventions"; }
+    FString GetApplyAllTag() override { return "Apply all naming conventions"; }
+
+    FString GetButtonStyleName() override { return "Action.Naming"; }
+    uint32 GetRequirements() override;
+    EAssetActionGranularity GetGranularity() override { return AAG_PerAsset; }
+    uint32 GetConfigFingerprint() override { return ConfigFingerprint; }
+    bool GetCacheInputs(const FAssetData& Asset, FString& OutInputs) override;
+    int32 GetResultDetail(FName Result) override;
+    void RestoreResultDetail(FName Result, int32 Detail) override;
+    bool EstimateImpact(const TArray<FAssetData>& Assets, FAssetActionImpact& OutImpact) override;
+    // Results are the suggested name, or a rule id for names that break a rule renaming can't fix
+    FString FormatResult(FName Result) override;
+    bool CanExecute(FName Result) override { return !IsRuleResult(Result); }
+
+    static TArray<FNamingPattern> GetDefaultPatterns();
+
+    static FString NamingPatternsToJson(const TArray<FNamingPattern>&);
+    static TArray<FNamingPattern> JsonToNamingPatterns(const FString&);
+
+private:
+    struct FNamingResult
+    {
+        FName Result;
+        // Rule the suggested name still breaks, INDEX_NONE if it follows every rule
+        int32 Violation = INDEX_NONE;
+    };
+
+    TArray<FNamingPattern> NamingPatterns;
+    // Rules of every pattern compiled into one automaton, same order as NamingPatterns
+    TArray<NamingRuleAutomaton> NamingRules;
+
+    // Tag names of every property filter, same layout as NamingPatterns
+    TArray<TArray<FName>> FilterTags;
+    // Any pattern filters on an object property, results then depend on the package contents
+    bool FiltersOnObjects = false;
+
+    // Rules a suggested name still breaks, only known for results of this session
+    TMap<FName, int32> RenameViolations;
+
+    FString GetNameForAsset(const FAssetData& Asset);
+
+    // Returns false if deciding requires an object property and Object is null while loading is not allowed
+    bool FindPattern(const FAssetData& Asset, UClass* Class, UObject*& Object, bool AllowLoad, int32& OutPattern) const;
+    // OutViolation is the rule id the resulting name breaks
+    FString ApplyPattern(int32 PatternIndex, const FString& Name, int32* OutViolation) const;
+    // None when the name follows its pattern. Never loads, false if Object is needed
+    bool GetResult(const FAssetData& Asset, UClass* Class, UObject* Object, FNamingResult& OutResult) const;
+    void AddResult(FAssetInfo& Asset, uint16 AssignedId, const FNamingResult& Result);
+
+    static bool IsRuleResult(FName Result);
+    FString GetViolationDescription(int32 Violation) const;
+
+    static FString GetRuleExpression(const FNamingRule& Rule);
+    static FString GetRuleDescription(const FNamingRule& Rule);
+    
+    FDelegateHandle OnConfigChangedHandle;
+    uint32 ConfigFingerprint = 0;
+};
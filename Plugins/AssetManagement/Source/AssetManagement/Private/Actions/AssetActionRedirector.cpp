@@ -1,37 +1,65 @@
-#include "AssetActionRedirector.h"
-#include "AssetRegistryModule.h"
-#include "AssetToolsModule.h"
-
-void AssetActionRedirector::ScanAssets(TArray<FAssetInfo>& Assets, uint16 AssignedId)
-{
-    for (FAssetInfo& Asset : Assets)
-    {
-        if(Asset.Data.IsRedirector() && Asset.Data.GetClass() == UObjectRedirector::StaticClass())
-        {    
-            UObjectRedirector* Redirector = StaticCast<UObjectRedirector*>(Asset.Data.GetAsset());
-            FString path = Redirector->DestinationObject->GetPathName();
-
-            int32 index;
-            if (path.FindLastChar('.', index))
-            {
-                path.RemoveAt(index, path.Len() - index);
-            }
-            
-            Asset.ActionResults.Add(AssignedId, path);
-        }
-    }
-}
-
-void AssetActionRedirector::ExecuteAction(TArray<FAssetData> Assets)
-{
-    TArray<UObjectRedirector*> Redirectors;
-    
-    for (FAssetData& Asset : Assets)
-    {
-        UObjectRedirector* Redirector = CastChecked<UObjectRedirector>(Asset.GetAsset());
-        Redirectors.Add(Redirector);
-    }
-    
-    FAssetToolsModule& AssetToolsModule = FModuleManager::LoadModuleChecked<FAssetToolsModule>(TEXT("AssetTools"));
-    AssetToolsModule.Get().FixupReferencers(Redirectors);
-}
+#include "AssetActionRedirector.h"
+#include "AssetRegistryModule.h"
+#include "AssetMagementCore.h"
+#include "RedirectorResolver.h"
+
+void AssetActionRedirector::ScanAssets(TArray<FAssetInfo>& Assets, uint16 AssignedId)
+{
+    FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
+
+    // Destinations come from the registry, chains are reported with their final target
+    RedirectorResolver Resolver;
+    Resolver.Build(AssetRegistryModule.Get());
+
+    for (FAssetInfo& Asset : Assets)
+    {
+        if (!Asset.Data.IsRedirector() || Asset.IsSuppressed(AssignedId)) continue;
+
+        const FName Target = Resolver.Resolve(Asset.Data.PackageName);
+        if (!Target.IsNone()) Asset.ActionResults.Add(AssignedId, Target);
+    }
+}
+
+void AssetActionRedirector::ExecuteAction(TArray<FAssetData> Assets)
+{
+    AssetManager* manager = AssetManager::Get();
+    if (manager == nullptr) return;
+
+    FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
+    IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
+
+    RedirectorResolver Resolver;
+    Resolver.Build(AssetRegistry);
+
+    TArray<FName> PackageNames;
+    for (FAssetData& Asset : Assets)
+    {
+        PackageNames.AddUnique(Asset.PackageName);
+    }
+
+    Resolver.Fix(PackageNames, AssetRegistry, manager->GetLoader());
+}
+
+bool AssetActionRedirector::EstimateImpact(const TArray<FAssetData>& Assets, FAssetActionImpact& OutImpact)
+{
+    AssetManager* manager = AssetManager::Get();
+    if (manager == nullptr) return false;
+
+    const AssetDependencyGraph& Graph = manager->GetDependencyGraph();
+
+    TArray<FName> PackageNames;
+    for (const FAssetData& Asset : Assets)
+    {
+        PackageNames.Add(Asset.PackageName);
+    }
+
+    // Referencers are resaved pointing at the final target, the redirectors are deleted afterwards
+    int64 ReferencerSize = 0;
+    OutImpact.ReferencersTouched = Graph.CountReferencers(PackageNames, ReferencerSize);
+    OutImpact.ResavedPackages = OutImpact.ReferencersTouched;
+    OutImpact.DeletedPackages = PackageNames.Num();
+    OutImpact.BytesWritten = ReferencerSize;
+    OutImpact.BytesDeleted = Graph.GetTotalSize(PackageNames);
+
+    return true;
+}
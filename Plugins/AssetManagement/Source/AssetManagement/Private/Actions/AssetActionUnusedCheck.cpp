@@ -1,86 +1,142 @@
-#include "AssetActionUnusedCheck.h"
-#include "AssetRegistryModule.h"
-#include "ObjectTools.h"
-
-void AssetActionUnusedCheck::ScanAssets(TArray<FAssetInfo>& Assets, uint16 AssignedId)
-{
-    FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
-    IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
-
-    TArray<FAssetData> Worlds;
-    AssetRegistry.GetAssetsByClass(UWorld::StaticClass()->GetFName(), Worlds, true);
-    
-    TMap<FName, uint16> References;
-
-    for (FAssetData& World : Worlds)
-    {
-        TArray<FAssetData> ToSearch = { World };
-        TArray<FAssetData> Searched;
-
-        while (ToSearch.Num() > 0)
-        {
-            FAssetData Asset = ToSearch[0];
-            ToSearch.RemoveAt(0);
-            Searched.Add(Asset);
-
-            if (!References.Contains(Asset.PackageName))
-            {
-                References.Add(Asset.PackageName, 1);
-            }
-            else
-            {
-                References[Asset.PackageName]++;
-            }
-
-            TArray<FName> Dependencies;
-            AssetRegistry.GetDependencies(Asset.PackageName, Dependencies);
-
-            for (FName& Dependency : Dependencies)
-            {
-                for (FAssetInfo& Link : Assets)
-                {
-                    if (Link.Data.PackageName.IsEqual(Dependency))
-                    {
-                        if (!Searched.Contains(Link.Data) && !ToSearch.Contains(Link.Data))
-                        {
-                            ToSearch.Add(Link.Data);
-                        }
-
-                        break;
-                    }
-                }
-            }
-        }
-    }
-
-    for (FAssetInfo& Asset : Assets)
-    {
-        if (!References.Contains(Asset.Data.PackageName) && Asset.Data.GetClass() != UObjectRedirector::StaticClass())
-        {
-            Asset.ActionResults.Add(AssignedId, "");
-        }
-    }
-}
-
-void AssetActionUnusedCheck::ExecuteAction(TArray<FAssetData> Assets)
-{
-    TArray<FAssetData> ToDelete;
-
-    bool AllYes = false;
-    bool AllNo = false;
-
-    for (FAssetData& Asset : Assets) 
-    {
-        EAppReturnType::Type SelectedOption = EAppReturnType::No;
-        if (!AllYes && !AllNo)
-        {
-            SelectedOption = FMessageDialog::Open(EAppMsgType::YesNoYesAllNoAll, EAppReturnType::NoAll, FText::FromString(FString("Are you sure you wish to delete the following file?\n") + Asset.AssetName.ToString()));
-            if (SelectedOption == EAppReturnType::YesAll) AllYes = true;
-            if (SelectedOption == EAppReturnType::NoAll) AllNo = true;
-        }
-
-        if (SelectedOption == EAppReturnType::Yes || AllYes) ToDelete.Add(Asset);
-    }
-    
-    if (Assets.Num() > 0) ObjectTools::DeleteAssets(ToDelete, false); //TODO add confirmation toggle to config
-}
+#include "AssetActionUnusedCheck.h"
+#include "AssetRegistryModule.h"
+#include "AssetBulkDelete.h"
+#include "AssetMagementCore.h"
+#include "AssetMagementConfig.h"
+#include "AssetScanWorkers.h"
+
+#define CLOSURE_YIELD_MASK 4095
+
+void AssetActionUnusedCheck::ScanAssets(TArray<FAssetInfo>& Assets, uint16 AssignedId)
+{
+    AssetManager* manager = AssetManager::Get();
+    if (manager == nullptr) return;
+
+    const AssetDependencyGraph& Graph = manager->GetDependencyGraph();
+
+    // Closures are only valid for the graph they were computed on
+    if (Graph.GetGeneration() != CachedGeneration)
+    {
+        LevelClosures.Empty();
+        CachedGeneration = Graph.GetGeneration();
+    }
+
+    const TArray<FName> Levels = GetPlayableLevels();
+
+    // Drop closures of levels that are no longer playable
+    for (auto It = LevelClosures.CreateIterator(); It; ++It)
+    {
+        if (!Levels.Contains(It.Key())) It.RemoveCurrent();
+    }
+
+    TBitArray<> Reachable(false, Graph.Num());
+    for (FName& Level : Levels)
+    {
+        TBitArray<>* Closure = LevelClosures.Find(Level);
+        if (Closure == nullptr)
+        {
+            Closure = &LevelClosures.Add(Level, TBitArray<>(false, Graph.Num()));
+            ComputeClosure(Graph, { Level }, *Closure);
+        }
+
+        for (TConstSetBitIterator<> It(*Closure); It; ++It)
+        {
+            Reachable[It.GetIndex()] = true;
+        }
+    }
+
+    // Assets intentionally kept despite being unused still need their dependencies. There can be thousands of them,
+    // so they share one uncached search that skips everything the levels already reach
+    TSet<FName> SuppressedRoots;
+    for (auto& Suppressed : manager->GetSuppressedPackages())
+    {
+        if (AssignedId < 32 && (Suppressed.Value & (1u << AssignedId)) != 0) SuppressedRoots.Add(Suppressed.Key);
+    }
+
+    if (SuppressedRoots.Num() > 0) ComputeClosure(Graph, SuppressedRoots.Array(), Reachable);
+
+    for (FAssetInfo& Asset : Assets)
+    {
+        const int32 Node = Graph.FindNode(Asset.Data.PackageName);
+        const bool Referenced = Node != INDEX_NONE && Reachable[Node];
+
+        if (!Referenced && Asset.Data.GetClass() != UObjectRedirector::StaticClass())
+        {
+            Asset.ActionResults.Add(AssignedId, NAME_None);
+        }
+    }
+}
+
+uint32 AssetActionUnusedCheck::GetConfigFingerprint()
+{
+    return FCrc::StrCrc32(*AssetManagerConfig::Get().GetString("Actions", "PlayableLevels", ""));
+}
+
+TArray<FName> AssetActionUnusedCheck::GetPlayableLevels()
+{
+    TArray<FName> Levels;
+
+    TArray<FString> LevelPaths;
+    AssetManagerConfig::Get().GetString("Actions", "PlayableLevels", "").ParseIntoArray(LevelPaths, TEXT(","));
+    for (FString& LevelPath : LevelPaths)
+    {
+        FSoftObjectPath Path(LevelPath.TrimStartAndEnd());
+        if (Path.IsValid()) Levels.AddUnique(FName(*Path.GetLongPackageName()));
+    }
+
+    // Without configured levels every level in the project is treated as playable
+    if (Levels.Num() == 0)
+    {
+        FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
+        IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
+
+        TArray<FAssetData> Worlds;
+        AssetRegistry.GetAssetsByClass(UWorld::StaticClass()->GetFName(), Worlds, true);
+
+        for (FAssetData& World : Worlds)
+        {
+            Levels.AddUnique(World.PackageName);
+        }
+    }
+
+    return Levels;
+}
+
+void AssetActionUnusedCheck::ComputeClosure(const AssetDependencyGraph& Graph, const TArray<FName>& Roots, TBitArray<>& Closure)
+{
+    TArray<int32> ToSearch;
+    for (FName Root : Roots)
+    {
+        const int32 Node = Graph.FindNode(Root);
+        if (Node == INDEX_NONE || Closure[Node]) continue;
+
+        Closure[Node] = true;
+        ToSearch.Add(Node);
+    }
+
+    int32 Visited = 0;
+    while (ToSearch.Num() > 0)
+    {
+        if ((++Visited & CLOSURE_YIELD_MASK) == 0) AssetScanWorkers::YieldPoint();
+
+        const int32 Node = ToSearch.Pop(false);
+
+        for (int32 Dependency : Graph.GetDependencies(Node))
+        {
+            if (Closure[Dependency]) continue;
+
+            Closure[Dependency] = true;
+            ToSearch.Add(Dependency);
+        }
+    }
+}
+
+void AssetActionUnusedCheck::ExecuteAction(TArray<FAssetData> Assets)
+{
+    AssetBulkDelete::DeleteUnreferenced(Assets);
+}
+
+bool AssetActionUnusedCheck::EstimateImpact(const TArray<FAssetData>& Assets, FAssetActionImpact& OutImpact)
+{
+    return AssetBulkDelete::EstimateImpact(Assets, OutImpact);
+}
@@ -1,14 +1,29 @@
-#pragma once
-#include "../AssetAction.h"
-
-class AssetActionUnusedCheck : public IAssetAction
-{
-public:
-    void ScanAssets(TArray<FAssetInfo>& Assets, uint16 AssignedId) override;
-    void ExecuteAction(TArray<FAssetData> Assets) override;
-    FString GetTooltipHeading() override { return "Unused Asset"; }
-    FString GetTooltipContent() override { return "This asset is not used by a playable level.\n\nClick to delete"; }
-    FString GetFilterName() override { return "Unused assets"; }
-    FString GetApplyAllTag() override { return "Delete all unused assets"; }
-    FString GetButtonStyleName() override { return "Action.Unused"; }
-};
+#pragma once
+#include "AssetAction.h"
+#include "AssetDependencyGraph.h"
+
+class AssetActionUnusedCheck : public IAssetAction
+{
+public:
+    void ScanAssets(TArray<FAssetInfo>& Assets, uint16 AssignedId) override;
+    void ExecuteAction(TArray<FAssetData> Assets) override;
+    FString GetTooltipHeading() override { return "Unused Asset"; }
+    FString GetTooltipContent() override { return "This asset is not used by a playable level.\n\nClick to delete"; }
+    FString GetFilterName() override { return "Unused assets"; }
+    FString GetApplyAllTag() override { return "Delete all unused assets"; }
+    FString GetButtonStyleName() override { return "Action.Unused"; }
+    uint32 GetRequirements() override { return AAR_Dependencies; }
+    EAssetActionGranularity GetGranularity() override { return AAG_WholeGraph; }
+    uint32 GetConfigFingerprint() override;
+    bool EstimateImpact(const TArray<FAssetData>& Assets, FAssetActionImpact& OutImpact) override;
+    bool ConfirmsExecution() override { return true; }
+
+private:
+    TArray<FName> GetPlayableLevels();
+    // Marks everything reachable from the roots, nodes already set in Closure are not searched again
+    void ComputeClosure(const AssetDependencyGraph& Graph, const TArray<FName>& Roots, TBitArray<>& Closure);
+
+    // Transitive dependencies of every playable level, so changing the levels only computes the new ones
+    TMap<FName, TBitArray<>> LevelClosures;
+    uint32 CachedGeneration = 0;
+};
@@ -0,0 +1,255 @@
+#include "AssetBulkDelete.h"
+#include "AssetMagementCore.h"
+#include "AssetMagementConfig.h"
+#include "PackageHashCache.h"
+#include "ObjectTools.h"
+#include "AssetRegistryModule.h"
+#include "Misc/ScopedSlowTask.h"
+#include "Misc/MessageDialog.h"
+#include "ISourceControlModule.h"
+#include "ISourceControlProvider.h"
+#include "SourceControlOperations.h"
+#include "Framework/Notifications/NotificationManager.h"
+#include "Widgets/Notifications/SNotificationList.h"
+
+#define MAX_LISTED_DELETIONS 10
+
+int32 AssetBulkDelete::DeleteUnreferenced(const TArray<FAssetData>& Assets)
+{
+    if (Assets.Num() == 0) return 0;
+
+    TArray<FAssetData> Unreferenced;
+    TArray<FAssetData> Referenced;
+    SplitByReferencers(Assets, Unreferenced, Referenced);
+
+    if (!Confirm(Assets, Referenced.Num())) return 0;
+
+    TArray<FAssetData> Sorted = SortReferencersFirst(Unreferenced);
+    UpdateSourceControlStatus(Sorted);
+
+    const int32 ChunkSize = FMath::Max(1, AssetManagerConfig::Get().GetInt("Actions", "DeleteChunkSize", 100));
+    const int32 NumChunks = FMath::DivideAndRoundUp(Sorted.Num(), ChunkSize);
+
+    FScopedSlowTask SlowTask(NumChunks, FText::FromString("Deleting unused assets"));
+    SlowTask.MakeDialog(true);
+
+    int32 Deleted = 0;
+    bool Cancelled = false;
+
+    for (int32 Chunk = 0; Chunk < NumChunks; Chunk++)
+    {
+        if (SlowTask.ShouldCancel())
+        {
+            Cancelled = true;
+            break;
+        }
+
+        const int32 Start = Chunk * ChunkSize;
+        const int32 End = FMath::Min(Start + ChunkSize, Sorted.Num());
+        SlowTask.EnterProgressFrame(1, FText::FromString(FString::Printf(TEXT("Deleting assets %d - %d of %d"), Start + 1, End, Sorted.Num())));
+
+        TArray<UObject*> Objects;
+        for (int32 i = Start; i < End; i++)
+        {
+            UObject* Object = Sorted[i].GetAsset();
+            if (Object != nullptr) Objects.Add(Object);
+        }
+
+        if (Objects.Num() > 0)
+        {
+            Deleted += ObjectTools::DeleteObjectsUnchecked(Objects);
+        }
+    }
+
+    // Still referenced from outside of the set, the editor checks and lists the references before anything is deleted
+    if (!Cancelled && Referenced.Num() > 0)
+    {
+        TArray<UObject*> Objects;
+        for (FAssetData& Asset : Referenced)
+        {
+            UObject* Object = Asset.GetAsset();
+            if (Object != nullptr) Objects.Add(Object);
+        }
+
+        if (Objects.Num() > 0) Deleted += ObjectTools::DeleteObjects(Objects, true);
+    }
+
+    FString Message = "Deleted " + FString::FromInt(Deleted) + " asset(s)";
+    if (Cancelled) Message += ", cancelled before finishing";
+
+    FNotificationInfo Notification(FText::FromString(Message));
+    Notification.ExpireDuration = 3.0f;
+    FSlateNotificationManager::Get().AddNotification(Notification);
+
+    return Deleted;
+}
+
+bool AssetBulkDelete::EstimateImpact(const TArray<FAssetData>& Assets, FAssetActionImpact& OutImpact)
+{
+    AssetManager* manager = AssetManager::Get();
+    if (manager == nullptr) return false;
+
+    const AssetDependencyGraph& Graph = manager->GetDependencyGraph();
+
+    TArray<FName> PackageNames;
+    for (const FAssetData& Asset : Assets)
+    {
+        PackageNames.Add(Asset.PackageName);
+    }
+
+    // Assets with referencers outside of the set are deleted with the editor's reference check, so these packages may keep them
+    int64 ReferencerSize = 0;
+    OutImpact.ReferencersTouched = Graph.CountReferencers(PackageNames, ReferencerSize);
+    OutImpact.DeletedPackages = PackageNames.Num();
+    OutImpact.BytesDeleted = Graph.GetTotalSize(PackageNames);
+
+    return true;
+}
+
+bool AssetBulkDelete::Confirm(const TArray<FAssetData>& Assets, int32 NumReferenced)
+{
+    FAssetActionImpact Impact;
+    EstimateImpact(Assets, Impact);
+
+    FString Message = "Are you sure you wish to delete " + FString::FromInt(Assets.Num()) + " unused asset(s), " + FText::AsMemory(Impact.BytesDeleted).ToString() + " on disk?\n\n" + Impact.ToString() + "\n";
+    if (NumReferenced > 0)
+    {
+        Message += "\n" + FString::FromInt(NumReferenced) + " asset(s) are still referenced by packages outside of the selection, their references are checked before deleting\n";
+    }
+    for (int32 i = 0; i < Assets.Num() && i < MAX_LISTED_DELETIONS; i++)
+    {
+        Message += "\n" + Assets[i].AssetName.ToString();
+    }
+
+    if (Assets.Num() > MAX_LISTED_DELETIONS)
+    {
+        Message += "\n... and " + FString::FromInt(Assets.Num() - MAX_LISTED_DELETIONS) + " more";
+    }
+
+    return FMessageDialog::Open(EAppMsgType::YesNo, EAppReturnType::No, FText::FromString(Message)) == EAppReturnType::Yes;
+}
+
+void AssetBulkDelete::SplitByReferencers(const TArray<FAssetData>& Assets, TArray<FAssetData>& OutUnreferenced, TArray<FAssetData>& OutReferenced)
+{
+    FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
+    IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
+
+    TSet<FName> Unreferenced;
+    for (const FAssetData& Asset : Assets)
+    {
+        Unreferenced.Add(Asset.PackageName);
+    }
+
+    // Packages with a referencer outside of the set seed the queue, the packages they reference inside the set follow
+    TMap<FName, TArray<FName>> ReferencedInSet;
+    TArray<FName> Queue;
+    TArray<FName> PackageReferencers;
+    for (FName PackageName : Unreferenced)
+    {
+        PackageReferencers.Reset();
+        AssetRegistry.GetReferencers(PackageName, PackageReferencers);
+
+        bool External = false;
+        for (FName Referencer : PackageReferencers)
+        {
+            if (Referencer == PackageName) continue;
+
+            if (Unreferenced.Contains(Referencer)) ReferencedInSet.FindOrAdd(Referencer).Add(PackageName);
+            else External = true;
+        }
+
+        if (External) Queue.Add(PackageName);
+    }
+
+    // An asset referenced by one that keeps its reference check may not be deleted without it either
+    for (int32 Head = 0; Head < Queue.Num(); Head++)
+    {
+        if (Unreferenced.Remove(Queue[Head]) == 0) continue;
+
+        const TArray<FName>* Dependencies = ReferencedInSet.Find(Queue[Head]);
+        if (Dependencies != nullptr) Queue.Append(*Dependencies);
+    }
+
+    for (const FAssetData& Asset : Assets)
+    {
+        if (Unreferenced.Contains(Asset.PackageName)) OutUnreferenced.Add(Asset);
+        else OutReferenced.Add(Asset);
+    }
+}
+
+TArray<FAssetData> AssetBulkDelete::SortReferencersFirst(const TArray<FAssetData>& Assets)
+{
+    AssetManager* manager = AssetManager::Get();
+    if (manager == nullptr) return Assets;
+
+    const AssetDependencyGraph& Graph = manager->GetDependencyGraph();
+
+    TArray<int32> Nodes;
+    TMap<int32, int32> NodeToAsset;
+    for (int32 i = 0; i < Assets.Num(); i++)
+    {
+        Nodes.Add(Graph.FindNode(Assets[i].PackageName));
+        if (Nodes[i] != INDEX_NONE) NodeToAsset.Add(Nodes[i], i);
+    }
+
+    // Count the referencers of every asset that are also going to be deleted
+    TArray<int32> PendingReferencers;
+    PendingReferencers.SetNumZeroed(Assets.Num());
+    for (int32 i = 0; i < Assets.Num(); i++)
+    {
+        if (Nodes[i] == INDEX_NONE) continue;
+
+        for (int32 Referencer : Graph.GetReferencers(Nodes[i]))
+        {
+            if (NodeToAsset.Contains(Referencer)) PendingReferencers[i]++;
+        }
+    }
+
+    TArray<int32> Queue;
+    for (int32 i = 0; i < Assets.Num(); i++)
+    {
+        if (PendingReferencers[i] == 0) Queue.Add(i);
+    }
+
+    TArray<FAssetData> Sorted;
+    TBitArray<> Added(false, Assets.Num());
+
+    for (int32 Head = 0; Head < Queue.Num(); Head++)
+    {
+        const int32 Index = Queue[Head];
+        Sorted.Add(Assets[Index]);
+        Added[Index] = true;
+
+        if (Nodes[Index] == INDEX_NONE) continue;
+
+        for (int32 Dependency : Graph.GetDependencies(Nodes[Index]))
+        {
+            const int32* Target = NodeToAsset.Find(Dependency);
+            if (Target != nullptr && --PendingReferencers[*Target] == 0) Queue.Add(*Target);
+        }
+    }
+
+    // Assets referencing each other in a cycle can't be ordered, they are deleted last
+    for (int32 i = 0; i < Assets.Num(); i++)
+    {
+        if (!Added[i]) Sorted.Add(Assets[i]);
+    }
+
+    return Sorted;
+}
+
+void AssetBulkDelete::UpdateSourceControlStatus(const TArray<FAssetData>& Assets)
+{
+    ISourceControlModule& SourceControlModule = ISourceControlModule::Get();
+    if (!SourceControlModule.IsEnabled()) return;
+
+    TArray<FString> Filenames;
+    for (const FAssetData& Asset : Assets)
+    {
+        Filenames.Add(FPaths::ConvertRelativePathToFull(PackageHashCache::GetPackageFilename(Asset)));
+    }
+
+    // One status request for everything, the per package delete bookkeeping then hits the provider cache
+    ISourceControlProvider& SourceControlProvider = SourceControlModule.GetProvider();
+    SourceControlProvider.Execute(ISourceControlOperation::Create<FUpdateStatus>(), Filenames);
+}
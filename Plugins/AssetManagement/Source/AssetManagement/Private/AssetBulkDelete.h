@@ -0,0 +1,22 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "AssetData.h"
+#include "AssetAction.h"
+
+// Deletes large sets of unreferenced assets in cancellable chunks, referencers before the assets they depend on
+class AssetBulkDelete
+{
+public:
+    // The per asset reference check is only skipped for assets whose referencers are all part of the set,
+    // everything else goes through the regular editor delete that checks references
+    static int32 DeleteUnreferenced(const TArray<FAssetData>& Assets);
+
+    static bool EstimateImpact(const TArray<FAssetData>& Assets, FAssetActionImpact& OutImpact);
+
+private:
+    static bool Confirm(const TArray<FAssetData>& Assets, int32 NumReferenced);
+    // Uses the live registry, the scan may be older than the last change
+    static void SplitByReferencers(const TArray<FAssetData>& Assets, TArray<FAssetData>& OutUnreferenced, TArray<FAssetData>& OutReferenced);
+    static TArray<FAssetData> SortReferencersFirst(const TArray<FAssetData>& Assets);
+    static void UpdateSourceControlStatus(const TArray<FAssetData>& Assets);
+};
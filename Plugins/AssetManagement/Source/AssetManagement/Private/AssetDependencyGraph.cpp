@@ -0,0 +1,266 @@
+#include "AssetDependencyGraph.h"
+#include "AssetRegistryModule.h"
+
+void AssetDependencyGraph::Build(IAssetRegistry& AssetRegistry, const TArray<FName>& PackageNames)
+{
+    Reset();
+
+    Packages = PackageNames;
+    NodeLookup.Reserve(Packages.Num());
+    for (int32 i = 0; i < Packages.Num(); i++)
+    {
+        NodeLookup.Add(Packages[i], i);
+    }
+
+    PackageSizes.SetNumZeroed(Packages.Num());
+    DependencyOffsets.SetNumUninitialized(Packages.Num() + 1);
+
+    // Last row each node was added to, so duplicates are rejected in constant time
+    TArray<int32> LastRow;
+    LastRow.Init(INDEX_NONE, Packages.Num());
+
+    TArray<FName> PackageDependencies;
+    for (int32 i = 0; i < Packages.Num(); i++)
+    {
+        DependencyOffsets[i] = Dependencies.Num();
+        AddRow(AssetRegistry, i, LastRow, PackageDependencies);
+    }
+    DependencyOffsets[Packages.Num()] = Dependencies.Num();
+
+    BuildReferencers();
+}
+
+void AssetDependencyGraph::Patch(IAssetRegistry& AssetRegistry, const TArray<FName>& Changed, const TArray<FName>& Removed)
+{
+    TSet<FName> RemovedSet(Removed);
+
+    // Old node to new node, removed nodes are compacted away
+    TArray<int32> Remap;
+    Remap.Init(INDEX_NONE, Packages.Num());
+    TArray<FName> NewPackages;
+    NewPackages.Reserve(Packages.Num() + Changed.Num());
+    for (int32 i = 0; i < Packages.Num(); i++)
+    {
+        if (!RemovedSet.Contains(Packages[i])) Remap[i] = NewPackages.Add(Packages[i]);
+    }
+
+    TMap<FName, int32> NewLookup;
+    NewLookup.Reserve(NewPackages.Num() + Changed.Num());
+    for (int32 i = 0; i < NewPackages.Num(); i++)
+    {
+        NewLookup.Add(NewPackages[i], i);
+    }
+
+    TBitArray<> Refresh(false, NewPackages.Num() + Changed.Num());
+    TArray<FName> Added;
+    for (FName PackageName : Changed)
+    {
+        const int32* Existing = NewLookup.Find(PackageName);
+        if (Existing != nullptr)
+        {
+            Refresh[*Existing] = true;
+            continue;
+        }
+
+        const int32 Node = NewPackages.Add(PackageName);
+        NewLookup.Add(PackageName, Node);
+        Refresh[Node] = true;
+        Added.Add(PackageName);
+    }
+
+    // Rows of unchanged packages skipped references to packages that were not part of the graph yet
+    TArray<FName> PackageReferencers;
+    for (FName PackageName : Added)
+    {
+        PackageReferencers.Reset();
+        AssetRegistry.GetReferencers(PackageName, PackageReferencers);
+        for (FName Referencer : PackageReferencers)
+        {
+            const int32* Node = NewLookup.Find(Referencer);
+            if (Node != nullptr) Refresh[*Node] = true;
+        }
+    }
+
+    TArray<int64> OldSizes = MoveTemp(PackageSizes);
+    TArray<int32> OldOffsets = MoveTemp(DependencyOffsets);
+    TArray<int32> OldDependencies = MoveTemp(Dependencies);
+
+    Generation++;
+    Packages = MoveTemp(NewPackages);
+    NodeLookup = MoveTemp(NewLookup);
+    PackageSizes.SetNumZeroed(Packages.Num());
+    DependencyOffsets.SetNumUninitialized(Packages.Num() + 1);
+    Dependencies.Reset(OldDependencies.Num());
+
+    TArray<int32> OldNodes;
+    OldNodes.Init(INDEX_NONE, Packages.Num());
+    for (int32 i = 0; i < Remap.Num(); i++)
+    {
+        if (Remap[i] != INDEX_NONE) OldNodes[Remap[i]] = i;
+    }
+
+    TArray<int32> LastRow;
+    LastRow.Init(INDEX_NONE, Packages.Num());
+
+    TArray<FName> PackageDependencies;
+    for (int32 i = 0; i < Packages.Num(); i++)
+    {
+        DependencyOffsets[i] = Dependencies.Num();
+
+        const int32 Old = OldNodes[i];
+        if (Refresh[i] || Old == INDEX_NONE)
+        {
+            AddRow(AssetRegistry, i, LastRow, PackageDependencies);
+            continue;
+        }
+
+        PackageSizes[i] = OldSizes[Old];
+        for (int32 j = OldOffsets[Old]; j < OldOffsets[Old + 1]; j++)
+        {
+            const int32 Target = Remap[OldDependencies[j]];
+            if (Target != INDEX_NONE) Dependencies.Add(Target);
+        }
+    }
+    DependencyOffsets[Packages.Num()] = Dependencies.Num();
+
+    BuildReferencers();
+}
+
+void AssetDependencyGraph::AddRow(IAssetRegistry& AssetRegistry, int32 Node, TArray<int32>& LastRow, TArray<FName>& PackageDependencies)
+{
+#if ENGINE_MAJOR_VERSION >= 5
+    TOptional<FAssetPackageData> PackageData = AssetRegistry.GetAssetPackageDataCopy(Packages[Node]);
+    if (PackageData.IsSet()) PackageSizes[Node] = PackageData->DiskSize;
+#else
+    const FAssetPackageData* PackageData = AssetRegistry.GetAssetPackageData(Packages[Node]);
+    if (PackageData != nullptr) PackageSizes[Node] = PackageData->DiskSize;
+#endif
+
+    PackageDependencies.Reset();
+    AssetRegistry.GetDependencies(Packages[Node], PackageDependencies);
+
+    for (FName& Dependency : PackageDependencies)
+    {
+        const int32* Target = NodeLookup.Find(Dependency);
+        if (Target == nullptr || *Target == Node || LastRow[*Target] == Node) continue;
+
+        LastRow[*Target] = Node;
+        Dependencies.Add(*Target);
+    }
+}
+
+void AssetDependencyGraph::Build(TArray<FName>&& PackageNames, TArray<int64>&& Sizes, TArray<int32>&& Offsets, TArray<int32>&& Edges)
+{
+    Reset();
+
+    Packages = MoveTemp(PackageNames);
+    PackageSizes = MoveTemp(Sizes);
+    DependencyOffsets = MoveTemp(Offsets);
+    Dependencies = MoveTemp(Edges);
+
+    NodeLookup.Reserve(Packages.Num());
+    for (int32 i = 0; i < Packages.Num(); i++)
+    {
+        NodeLookup.Add(Packages[i], i);
+    }
+
+    BuildReferencers();
+}
+
+void AssetDependencyGraph::BuildReferencers()
+{
+    // Transpose the dependency rows into referencer rows with a counting pass
+    ReferencerOffsets.SetNumZeroed(Packages.Num() + 1);
+    for (int32 Target : Dependencies)
+    {
+        ReferencerOffsets[Target + 1]++;
+    }
+
+    for (int32 i = 0; i < Packages.Num(); i++)
+    {
+        ReferencerOffsets[i + 1] += ReferencerOffsets[i];
+    }
+
+    TArray<int32> Cursor = ReferencerOffsets;
+    Referencers.SetNumUninitialized(Dependencies.Num());
+    for (int32 i = 0; i < Packages.Num(); i++)
+    {
+        for (int32 Target : GetDependencies(i))
+        {
+            Referencers[Cursor[Target]++] = i;
+        }
+    }
+}
+
+void AssetDependencyGraph::Reset()
+{
+    Generation++;
+
+    Packages.Reset();
+    PackageSizes.Reset();
+    NodeLookup.Reset();
+    DependencyOffsets.Reset();
+    Dependencies.Reset();
+    ReferencerOffsets.Reset();
+    Referencers.Reset();
+}
+
+int32 AssetDependencyGraph::FindNode(FName PackageName) const
+{
+    const int32* Node = NodeLookup.Find(PackageName);
+    return Node != nullptr ? *Node : INDEX_NONE;
+}
+
+TArrayView<const int32> AssetDependencyGraph::GetDependencies(int32 Node) const
+{
+    return TArrayView<const int32>(Dependencies.GetData() + DependencyOffsets[Node], DependencyOffsets[Node + 1] - DependencyOffsets[Node]);
+}
+
+TArrayView<const int32> AssetDependencyGraph::GetReferencers(int32 Node) const
+{
+    return TArrayView<const int32>(Referencers.GetData() + ReferencerOffsets[Node], ReferencerOffsets[Node + 1] - ReferencerOffsets[Node]);
+}
+
+int64 AssetDependencyGraph::GetTotalSize(const TArray<FName>& PackageNames) const
+{
+    int64 TotalSize = 0;
+    for (FName PackageName : PackageNames)
+    {
+        const int32 Node = FindNode(PackageName);
+        if (Node != INDEX_NONE) TotalSize += PackageSizes[Node];
+    }
+
+    return TotalSize;
+}
+
+int32 AssetDependencyGraph::CountReferencers(const TArray<FName>& PackageNames, int64& OutTotalSize) const
+{
+    TBitArray<> InSet(false, Packages.Num());
+    TArray<int32> Nodes;
+    for (FName PackageName : PackageNames)
+    {
+        const int32 Node = FindNode(PackageName);
+        if (Node == INDEX_NONE || InSet[Node]) continue;
+
+        InSet[Node] = true;
+        Nodes.Add(Node);
+    }
+
+    TBitArray<> Counted(false, Packages.Num());
+    int32 Count = 0;
+    OutTotalSize = 0;
+
+    for (int32 Node : Nodes)
+    {
+        for (int32 Referencer : GetReferencers(Node))
+        {
+            if (InSet[Referencer] || Counted[Referencer]) continue;
+
+            Counted[Referencer] = true;
+            Count++;
+            OutTotalSize += PackageSizes[Referencer];
+        }
+    }
+
+    return Count;
+}
@@ -0,0 +1,48 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "Containers/ArrayView.h"
+
+class IAssetRegistry;
+
+// Package dependency graph stored as compressed sparse rows, shared by all actions during a scan
+class AssetDependencyGraph
+{
+public:
+    void Build(IAssetRegistry& AssetRegistry, const TArray<FName>& PackageNames);
+    void Build(TArray<FName>&& PackageNames, TArray<int64>&& Sizes, TArray<int32>&& Offsets, TArray<int32>&& Edges);
+    // Queries the registry only for the changed packages and for packages that reference newly added ones, all other rows are copied
+    void Patch(IAssetRegistry& AssetRegistry, const TArray<FName>& Changed, const TArray<FName>& Removed);
+    void Reset();
+
+    int32 Num() const { return Packages.Num(); }
+    uint32 GetGeneration() const { return Generation; }
+    int32 FindNode(FName PackageName) const;
+
+    FName GetPackageName(int32 Node) const { return Packages[Node]; }
+    int64 GetPackageSize(int32 Node) const { return PackageSizes[Node]; }
+
+    TArrayView<const int32> GetDependencies(int32 Node) const;
+    TArrayView<const int32> GetReferencers(int32 Node) const;
+
+    // Used for dry runs, packages missing from the graph count as empty
+    int64 GetTotalSize(const TArray<FName>& PackageNames) const;
+    // Unique packages outside of the given set that reference any of them
+    int32 CountReferencers(const TArray<FName>& PackageNames, int64& OutTotalSize) const;
+
+private:
+    // Appends the row of a node from the registry, NodeLookup has to contain every node already
+    void AddRow(IAssetRegistry& AssetRegistry, int32 Node, TArray<int32>& LastRow, TArray<FName>& PackageDependencies);
+    void BuildReferencers();
+
+    TArray<FName> Packages;
+    TArray<int64> PackageSizes;
+    TMap<FName, int32> NodeLookup;
+
+    TArray<int32> DependencyOffsets;
+    TArray<int32> Dependencies;
+
+    TArray<int32> ReferencerOffsets;
+    TArray<int32> Referencers;
+
+    uint32 Generation = 0;
+};
@@ -0,0 +1,368 @@
+#include "AssetIndexFile.h"
+#include "AssetDependencyGraph.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFilemanager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+#define ASSET_INDEX_MAGIC 0x414D4958
+#define ASSET_INDEX_VERSION 1
+#define ASSET_INDEX_MAX_ACTIONS 32
+
+#define LEGACY_FILE_MAPPING (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION < 20)
+
+struct FAssetIndexHeader
+{
+    uint32 Magic;
+    uint32 Version;
+
+    uint32 NumStrings;
+    uint32 NumActions;
+    uint32 NumAssets;
+    uint32 NumPayloads;
+    uint32 NumNodes;
+    uint32 NumEdges;
+
+    uint64 StringDataSize;
+    uint64 StringOffsetsOffset;
+    uint64 StringDataOffset;
+    uint64 ActionsOffset;
+    uint64 AssetsOffset;
+    uint64 PayloadsOffset;
+    uint64 NodesOffset;
+    uint64 SizesOffset;
+    uint64 EdgeOffsetsOffset;
+    uint64 EdgesOffset;
+};
+
+struct FAssetIndexRecord
+{
+    uint32 PackageName;
+    uint32 PackagePath;
+    uint32 AssetName;
+    uint32 AssetClass;
+    uint32 ResultBits;
+    uint32 FirstPayload;
+};
+
+AssetIndexFile::~AssetIndexFile()
+{
+    Close();
+}
+
+bool AssetIndexFile::Write(const FString& Path, const TSparseArray<FAssetInfo>& Assets, const TArray<int32>& Slots, const AssetDependencyGraph& Graph, const TArray<FString>& ActionNames)
+{
+    TMap<FName, uint32> StringIds;
+    TArray<FName> Strings;
+    auto Intern = [&StringIds, &Strings](FName Value) -> uint32
+    {
+        const uint32* Existing = StringIds.Find(Value);
+        if (Existing != nullptr) return *Existing;
+
+        const uint32 Id = Strings.Add(Value);
+        StringIds.Add(Value, Id);
+        return Id;
+    };
+
+    TArray<uint32> Actions;
+    for (int32 i = 0; i < ActionNames.Num() && i < ASSET_INDEX_MAX_ACTIONS; i++)
+    {
+        Actions.Add(Intern(FName(*ActionNames[i])));
+    }
+
+    TArray<FAssetIndexRecord> Records;
+    TArray<uint32> Payloads;
+    Records.Reserve(Slots.Num());
+
+    for (int32 Slot : Slots)
+    {
+        const FAssetInfo& Asset = Assets[Slot];
+
+        FAssetIndexRecord Record;
+        Record.PackageName = Intern(Asset.Data.PackageName);
+        Record.PackagePath = Intern(Asset.Data.PackagePath);
+        Record.AssetName = Intern(Asset.Data.AssetName);
+        Record.AssetClass = Intern(Asset.Data.AssetClass);
+        Record.ResultBits = 0;
+        Record.FirstPayload = Payloads.Num();
+
+        for (int32 Action = 0; Action < Actions.Num(); Action++)
+        {
+            const FName* Result = Asset.ActionResults.Find(Action);
+            if (Result == nullptr) continue;
+
+            Record.ResultBits |= 1u << Action;
+            Payloads.Add(Intern(*Result));
+        }
+
+        Records.Add(Record);
+    }
+
+    TArray<uint32> Nodes;
+    TArray<int64> Sizes;
+    TArray<int32> EdgeOffsets;
+    TArray<int32> Edges;
+
+    for (int32 Node = 0; Node < Graph.Num(); Node++)
+    {
+        Nodes.Add(Intern(Graph.GetPackageName(Node)));
+        Sizes.Add(Graph.GetPackageSize(Node));
+        EdgeOffsets.Add(Edges.Num());
+        Edges.Append(Graph.GetDependencies(Node).GetData(), Graph.GetDependencies(Node).Num());
+    }
+    EdgeOffsets.Add(Edges.Num());
+
+    TArray<uint32> StringOffsets;
+    TArray<uint8> StringData;
+    for (const FName& Value : Strings)
+    {
+        StringOffsets.Add(StringData.Num());
+        FTCHARToUTF8 Converter(*Value.ToString());
+        StringData.Append(reinterpret_cast<const uint8*>(Converter.Get()), Converter.Length());
+    }
+    StringOffsets.Add(StringData.Num());
+
+    // Write to a temporary file first so a crash never leaves a half written index behind
+    const FString TempPath = Path + TEXT(".tmp");
+    TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*TempPath));
+    if (!Writer.IsValid()) return false;
+
+    FAssetIndexHeader Header;
+    FMemory::Memzero(Header);
+    Writer->Serialize(&Header, sizeof(Header));
+
+    auto WriteSection = [&Writer](const void* Source, int64 Bytes) -> uint64
+    {
+        const uint64 Offset = Writer->Tell();
+        if (Bytes > 0) Writer->Serialize(const_cast<void*>(Source), Bytes);
+
+        uint8 Padding[8] = { 0 };
+        const int64 Remainder = Writer->Tell() % 8;
+        if (Remainder != 0) Writer->Serialize(Padding, 8 - Remainder);
+
+        return Offset;
+    };
+
+    Header.Magic = ASSET_INDEX_MAGIC;
+    Header.Version = ASSET_INDEX_VERSION;
+    Header.NumStrings = Strings.Num();
+    Header.NumActions = Actions.Num();
+    Header.NumAssets = Records.Num();
+    Header.NumPayloads = Payloads.Num();
+    Header.NumNodes = Nodes.Num();
+    Header.NumEdges = Edges.Num();
+    Header.StringDataSize = StringData.Num();
+
+    Header.StringOffsetsOffset = WriteSection(StringOffsets.GetData(), StringOffsets.Num() * sizeof(uint32));
+    Header.StringDataOffset = WriteSection(StringData.GetData(), StringData.Num());
+    Header.ActionsOffset = WriteSection(Actions.GetData(), Actions.Num() * sizeof(uint32));
+    Header.AssetsOffset = WriteSection(Records.GetData(), Records.Num() * sizeof(FAssetIndexRecord));
+    Header.PayloadsOffset = WriteSection(Payloads.GetData(), Payloads.Num() * sizeof(uint32));
+    Header.NodesOffset = WriteSection(Nodes.GetData(), Nodes.Num() * sizeof(uint32));
+    Header.SizesOffset = WriteSection(Sizes.GetData(), Sizes.Num() * sizeof(int64));
+    Header.EdgeOffsetsOffset = WriteSection(EdgeOffsets.GetData(), EdgeOffsets.Num() * sizeof(int32));
+    Header.EdgesOffset = WriteSection(Edges.GetData(), Edges.Num() * sizeof(int32));
+
+    Writer->Seek(0);
+    Writer->Serialize(&Header, sizeof(Header));
+
+    const bool Success = !Writer->IsError() && Writer->Close();
+    Writer.Reset();
+
+    return Success && IFileManager::Get().Move(*Path, *TempPath, true);
+}
+
+bool AssetIndexFile::Open(const FString& Path)
+{
+    Close();
+
+#if LEGACY_FILE_MAPPING
+    if (!FFileHelper::LoadFileToArray(FileData, *Path, FILEREAD_Silent)) return false;
+    Data = FileData.GetData();
+    DataSize = FileData.Num();
+#else
+    MappedHandle = FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*Path);
+    if (MappedHandle == nullptr) return false;
+
+    MappedRegion = MappedHandle->MapRegion();
+    if (MappedRegion == nullptr)
+    {
+        Close();
+        return false;
+    }
+
+    Data = MappedRegion->GetMappedPtr();
+    DataSize = MappedRegion->GetMappedSize();
+#endif
+
+    if (!Validate())
+    {
+        Close();
+        return false;
+    }
+
+    return true;
+}
+
+void AssetIndexFile::Close()
+{
+    delete MappedRegion;
+    MappedRegion = nullptr;
+
+    delete MappedHandle;
+    MappedHandle = nullptr;
+
+    FileData.Empty();
+    Data = nullptr;
+    DataSize = 0;
+}
+
+bool AssetIndexFile::Validate() const
+{
+    if (Data == nullptr || DataSize < static_cast<int64>(sizeof(FAssetIndexHeader))) return false;
+
+    const FAssetIndexHeader& Header = *GetSection<FAssetIndexHeader>(0);
+    if (Header.Magic != ASSET_INDEX_MAGIC || Header.Version != ASSET_INDEX_VERSION) return false;
+    if (Header.NumActions > ASSET_INDEX_MAX_ACTIONS) return false;
+
+    auto Fits = [this](uint64 Offset, uint64 Bytes) { return Offset % 4 == 0 && Offset + Bytes <= static_cast<uint64>(DataSize); };
+
+    return Fits(Header.StringOffsetsOffset, (Header.NumStrings + 1ull) * sizeof(uint32))
+        && Fits(Header.StringDataOffset, Header.StringDataSize)
+        && Fits(Header.ActionsOffset, Header.NumActions * sizeof(uint32))
+        && Fits(Header.AssetsOffset, Header.NumAssets * sizeof(FAssetIndexRecord))
+        && Fits(Header.PayloadsOffset, Header.NumPayloads * sizeof(uint32))
+        && Fits(Header.NodesOffset, Header.NumNodes * sizeof(uint32))
+        && Fits(Header.SizesOffset, Header.NumNodes * sizeof(int64))
+        && Fits(Header.EdgeOffsetsOffset, (Header.NumNodes + 1ull) * sizeof(int32))
+        && Fits(Header.EdgesOffset, Header.NumEdges * sizeof(int32));
+}
+
+FString AssetIndexFile::GetString(uint32 Id) const
+{
+    const FAssetIndexHeader& Header = *GetSection<FAssetIndexHeader>(0);
+    if (Id >= Header.NumStrings) return FString();
+
+    const uint32* Offsets = GetSection<uint32>(Header.StringOffsetsOffset);
+    const uint32 Start = Offsets[Id];
+    const uint32 End = Offsets[Id + 1];
+    if (Start > End || End > Header.StringDataSize) return FString();
+
+    const ANSICHAR* Source = GetSection<ANSICHAR>(Header.StringDataOffset) + Start;
+    FUTF8ToTCHAR Converter(Source, End - Start);
+    return FString(Converter.Length(), Converter.Get());
+}
+
+void AssetIndexFile::GetNames(TArray<FName>& OutNames) const
+{
+    const FAssetIndexHeader& Header = *GetSection<FAssetIndexHeader>(0);
+
+    OutNames.SetNum(Header.NumStrings);
+    for (uint32 i = 0; i < Header.NumStrings; i++)
+    {
+        OutNames[i] = FName(*GetString(i));
+    }
+}
+
+void AssetIndexFile::ReadAssets(const TArray<FString>& ActionNames, TArray<FAssetInfo>& OutAssets) const
+{
+    OutAssets.Reset();
+    if (Data == nullptr) return;
+
+    const FAssetIndexHeader& Header = *GetSection<FAssetIndexHeader>(0);
+
+    TArray<FName> Names;
+    GetNames(Names);
+
+    int32 ActionMapping[ASSET_INDEX_MAX_ACTIONS];
+    const uint32* Actions = GetSection<uint32>(Header.ActionsOffset);
+    for (uint32 i = 0; i < Header.NumActions; i++)
+    {
+        ActionMapping[i] = ActionNames.IndexOfByKey(GetString(Actions[i]));
+    }
+
+    const FAssetIndexRecord* Records = GetSection<FAssetIndexRecord>(Header.AssetsOffset);
+    const uint32* Payloads = GetSection<uint32>(Header.PayloadsOffset);
+
+    auto GetName = [&Names](uint32 Id) { return Names.IsValidIndex(Id) ? Names[Id] : NAME_None; };
+
+    OutAssets.Reserve(Header.NumAssets);
+    for (uint32 i = 0; i < Header.NumAssets; i++)
+    {
+        const FAssetIndexRecord& Record = Records[i];
+
+        FAssetInfo Info;
+        Info.Data = FAssetData(GetName(Record.PackageName), GetName(Record.PackagePath), GetName(Record.AssetName), GetName(Record.AssetClass));
+
+        uint32 Payload = Record.FirstPayload;
+        for (uint32 Action = 0; Action < Header.NumActions; Action++)
+        {
+            if ((Record.ResultBits & (1u << Action)) == 0) continue;
+
+            if (ActionMapping[Action] != INDEX_NONE && Payload < Header.NumPayloads)
+            {
+                Info.ActionResults.Add(ActionMapping[Action], GetName(Payloads[Payload]));
+            }
+            Payload++;
+        }
+
+        if (Info.ActionResults.Num() > 0)
+        {
+            OutAssets.Add(Info);
+        }
+    }
+}
+
+void AssetIndexFile::ReadGraph(AssetDependencyGraph& OutGraph) const
+{
+    OutGraph.Reset();
+    if (Data == nullptr) return;
+
+    const FAssetIndexHeader& Header = *GetSection<FAssetIndexHeader>(0);
+
+    TArray<FName> Names;
+    GetNames(Names);
+
+    TArray<FName> Packages;
+    const uint32* Nodes = GetSection<uint32>(Header.NodesOffset);
+    Packages.Reserve(Header.NumNodes);
+    for (uint32 i = 0; i < Header.NumNodes; i++)
+    {
+        Packages.Add(Names.IsValidIndex(Nodes[i]) ? Names[Nodes[i]] : NAME_None);
+    }
+
+    TArray<int64> Sizes(GetSection<int64>(Header.SizesOffset), Header.NumNodes);
+    TArray<int32> EdgeOffsets(GetSection<int32>(Header.EdgeOffsetsOffset), Header.NumNodes + 1);
+    TArray<int32> Edges(GetSection<int32>(Header.EdgesOffset), Header.NumEdges);
+
+    // Reject corrupted rows instead of reading out of bounds later on
+    for (uint32 i = 0; i < Header.NumNodes; i++)
+    {
+        if (EdgeOffsets[i] < 0 || EdgeOffsets[i] > EdgeOffsets[i + 1] || static_cast<uint32>(EdgeOffsets[i + 1]) > Header.NumEdges) return;
+    }
+
+    for (int32 Edge : Edges)
+    {
+        if (Edge < 0 || static_cast<uint32>(Edge) >= Header.NumNodes) return;
+    }
+
+    OutGraph.Build(MoveTemp(Packages), MoveTemp(Sizes), MoveTemp(EdgeOffsets), MoveTemp(Edges));
+}
+
+void AssetIndexFile::ReadActionNames(TArray<FString>& OutActionNames) const
+{
+    OutActionNames.Reset();
+    if (Data == nullptr) return;
+
+    const FAssetIndexHeader& Header = *GetSection<FAssetIndexHeader>(0);
+    const uint32* Actions = GetSection<uint32>(Header.ActionsOffset);
+    for (uint32 i = 0; i < Header.NumActions; i++)
+    {
+        OutActionNames.Add(GetString(Actions[i]));
+    }
+}
+
+FString AssetIndexFile::GetDefaultPath()
+{
+    return FPaths::Combine(FPaths::ProjectSavedDir(), FString("AssetManagement"), FString("AssetIndex.bin"));
+}
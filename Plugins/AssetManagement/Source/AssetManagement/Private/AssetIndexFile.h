@@ -0,0 +1,42 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "AssetAction.h"
+
+class AssetDependencyGraph;
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+// Compact snapshot of the last scan, mapped at startup so results can be shown before the asset registry is ready
+class AssetIndexFile
+{
+public:
+    ~AssetIndexFile();
+
+    // Records are written in the order of the given slots, package name order keeps snapshots mergeable in linear time
+    static bool Write(const FString& Path, const TSparseArray<FAssetInfo>& Assets, const TArray<int32>& Slots, const AssetDependencyGraph& Graph, const TArray<FString>& ActionNames);
+
+    bool Open(const FString& Path);
+    void Close();
+
+    // Results are matched to actions by name, results of actions that no longer exist are dropped
+    void ReadAssets(const TArray<FString>& ActionNames, TArray<FAssetInfo>& OutAssets) const;
+    void ReadGraph(AssetDependencyGraph& OutGraph) const;
+    void ReadActionNames(TArray<FString>& OutActionNames) const;
+
+    static FString GetDefaultPath();
+
+private:
+    template<typename T>
+    const T* GetSection(uint64 Offset) const { return reinterpret_cast<const T*>(Data + Offset); }
+
+    bool Validate() const;
+    FString GetString(uint32 Id) const;
+    void GetNames(TArray<FName>& OutNames) const;
+
+    const uint8* Data = nullptr;
+    int64 DataSize = 0;
+
+    IMappedFileHandle* MappedHandle = nullptr;
+    IMappedFileRegion* MappedRegion = nullptr;
+    TArray<uint8> FileData;
+};
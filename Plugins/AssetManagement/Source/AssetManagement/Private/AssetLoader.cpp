@@ -0,0 +1,100 @@
+#include "AssetLoader.h"
+#include "AssetMagementConfig.h"
+#include "Misc/ScopedSlowTask.h"
+#include "UObject/UObjectGlobals.h"
+#include "HAL/PlatformMemory.h"
+
+#define MEGABYTE (1024ull * 1024ull)
+
+void AssetLoader::Request(const FAssetData& Asset, FOnLoaded OnLoaded)
+{
+    const int32* Existing = RequestIndices.Find(Asset.ObjectPath);
+    if (Existing != nullptr)
+    {
+        Requests[*Existing].Callbacks.Add(MoveTemp(OnLoaded));
+        return;
+    }
+
+    const int32 Index = Requests.AddDefaulted();
+    Requests[Index].Asset = Asset;
+    Requests[Index].Callbacks.Add(MoveTemp(OnLoaded));
+    RequestIndices.Add(Asset.ObjectPath, Index);
+}
+
+void AssetLoader::Flush(bool KeepLoaded)
+{
+    if (Requests.Num() == 0) return;
+
+    // Swapped out first, callbacks may queue further requests for the next flush
+    TArray<FRequest> Pending = MoveTemp(Requests);
+    Requests.Reset();
+    RequestIndices.Reset();
+
+    const int32 BatchSize = FMath::Max(1, AssetManagerConfig::Get().GetInt("Scan", "LoadBatchSize", 64));
+    const int32 NumBatches = FMath::DivideAndRoundUp(Pending.Num(), BatchSize);
+
+    // A budget of 0 collects garbage after every batch
+    const uint64 Budget = static_cast<uint64>(FMath::Max(0, AssetManagerConfig::Get().GetInt("Scan", "MemoryBudgetMB", 4096))) * MEGABYTE;
+
+    FScopedSlowTask SlowTask(NumBatches, FText::FromString("Loading assets"));
+    SlowTask.MakeDialogDelayed(1.0f);
+
+    bool Collected = true;
+    for (int32 Batch = 0; Batch < NumBatches; Batch++)
+    {
+        SlowTask.EnterProgressFrame(1);
+
+        const int32 Start = Batch * BatchSize;
+        const int32 End = FMath::Min(Start + BatchSize, Pending.Num());
+
+        // All packages of a batch are in flight together so their reads overlap
+        bool LoadedPackages = false;
+        for (int32 i = Start; i < End; i++)
+        {
+            if (Pending[i].Asset.IsAssetLoaded()) continue;
+
+            LoadPackageAsync(Pending[i].Asset.PackageName.ToString());
+            LoadedPackages = true;
+        }
+
+        if (LoadedPackages) FlushAsyncLoading();
+
+        for (int32 i = Start; i < End; i++)
+        {
+            UObject* Object = Pending[i].Asset.GetAsset();
+            for (FOnLoaded& Callback : Pending[i].Callbacks)
+            {
+                Callback(Object);
+            }
+
+            // Callbacks may capture the objects they evaluated, drop them before a checkpoint
+            Pending[i].Callbacks.Empty();
+            Stats.Loaded++;
+        }
+
+        if (!LoadedPackages || KeepLoaded) continue;
+
+        SampleMemory();
+        Collected = false;
+
+        // Nothing references the objects loaded so far any more, release them before the next batch goes over the budget
+        if (Budget == 0 || FPlatformMemory::GetStats().UsedPhysical >= Budget)
+        {
+            CollectGarbage(GARBAGE_OBJECT_FLAGS);
+            Stats.Checkpoints++;
+            Collected = true;
+        }
+    }
+
+    // Whatever stayed below the budget is released once the flush is done
+    if (!Collected)
+    {
+        CollectGarbage(GARBAGE_OBJECT_FLAGS);
+        Stats.Checkpoints++;
+    }
+}
+
+void AssetLoader::SampleMemory()
+{
+    Stats.PeakUsedPhysical = FMath::Max<uint64>(Stats.PeakUsedPhysical, FPlatformMemory::GetStats().UsedPhysical);
+}
@@ -0,0 +1,42 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "AssetData.h"
+
+struct FAssetLoadStats
+{
+    int32 Loaded = 0;
+    int32 Checkpoints = 0;
+    uint64 PeakUsedPhysical = 0;
+};
+
+// Loads the packages requested by the actions in bounded asynchronous batches and hands every object to its requesters
+class AssetLoader
+{
+public:
+    typedef TFunction<void(UObject*)> FOnLoaded;
+
+    // The callback runs during the next Flush, with nullptr if the asset failed to load
+    void Request(const FAssetData& Asset, FOnLoaded OnLoaded);
+
+    // Garbage is collected between batches once the memory budget is exceeded, objects are only guaranteed to stay alive during their callbacks unless KeepLoaded is set
+    void Flush(bool KeepLoaded = false);
+
+    int32 Num() const { return Requests.Num(); }
+
+    // Updates the peak memory of the current stats, also called by the manager around a scan
+    void SampleMemory();
+
+    void ResetStats() { Stats = FAssetLoadStats(); }
+    const FAssetLoadStats& GetStats() const { return Stats; }
+
+private:
+    struct FRequest
+    {
+        FAssetData Asset;
+        TArray<FOnLoaded> Callbacks;
+    };
+
+    TArray<FRequest> Requests;
+    TMap<FName, int32> RequestIndices;
+    FAssetLoadStats Stats;
+};
@@ -1,308 +1,1065 @@
-#include "AssetMagementCore.h"
-#include "AssetManagementModule.h"
-#include "AssetRegistryModule.h"
-#include "Actions/AssetActionUnusedCheck.h"
-#include "Actions/AssetActionRedirector.h"
-#include "Actions/AssetActionNamingCheck.h"
-#include "Framework/Notifications/NotificationManager.h"
-#include "Editor.h"
-#include "Widgets/Notifications/SNotificationList.h"
-#include "AssetToolsModule.h"
-#include "AssetMagementConfig.h"
-
-AssetManager* instance_ = nullptr;
-
-AssetManager::FOnAssetListUpdated AssetManager::OnAssetListUpdated;
-
-void AssetManager::Create()
-{
-    if (instance_ != nullptr) UE_LOG(AssetManagementLog, Fatal, TEXT("AssetManager already started"))
-    instance_ = this;
-
-    AssetManagerConfig::Get().Load();
-
-    AssetActions.Add(MakeShareable(new AssetActionUnusedCheck()));
-    AssetActions.Add(MakeShareable(new AssetActionNamingCheck()));
-    AssetActions.Add(MakeShareable(new AssetActionRedirector()));
-    
-    FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
-    IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
-
-    if (AssetRegistry.IsLoadingAssets())
-    {
-        AssetRegistry.OnFilesLoaded().AddSP(this, &AssetManager::BindToAssetRegistry);
-    }
-    else
-    {
-        BindToAssetRegistry();
-    }
-}
-
-void AssetManager::Destroy()
-{
-    for(TSharedPtr<IAssetAction>& Action : AssetActions)
-    {
-        Action.Reset();
-    }
-
-    AssetActions.Empty();
-    
-    instance_ = nullptr;
-}
-
-TArray<FAssetInfo> AssetManager::GetAssets()
-{
-    AssetLock.Lock();
-    TArray<FAssetInfo> res = Assets;
-    AssetLock.Unlock();
-
-    return res;
-}
-
-TArray<IAssetAction*> AssetManager::GetActions()
-{
-    TArray<IAssetAction*> actions;
-    for(TSharedPtr<IAssetAction>& Action : AssetActions)
-    {
-        actions.Add(Action.Get());
-    }
-
-    return actions;
-}
-
-void AssetManager::RequestRescan()
-{
-    ScanAssets();
-}
-
-void AssetManager::OnAssetAdded(const FAssetData& Asset)
-{
-    bool found = false;
-    AssetLock.Lock();
-    for(FAssetInfo& info : Assets)
-    {
-        if (info.Data == Asset) { found = true; break; }
-    }
-    AssetLock.Unlock();
-    if (found) return;
-    
-    //TODO execute on separate thread
-    TArray<FAssetInfo> NewAssets = {{Asset, {}}};
-    ProcessAssets(NewAssets);
-
-    if (NewAssets.Num() > 0)
-    {
-        AssetLock.Lock();
-        for (FAssetInfo& info : NewAssets)
-        {
-            Assets.Add(info);
-        }
-        PrepareAssetList();
-        AssetLock.Unlock();
-        OnAssetListUpdated.ExecuteIfBound();
-    }
-}
-
-void AssetManager::OnAssetUpdated(const FAssetData&)
-{
-    RequestRescan(); //TODO redo dependency scan
-}
-
-void AssetManager::OnAssetRenamed(const FAssetData&, const FString&)
-{
-    RequestRescan(); //TODO improve renamed asset handling
-}
-
-void AssetManager::OnAssetRemoved(const FAssetData& Asset)
-{
-    bool changed = false;
-    AssetLock.Lock();
-    for (int i = 0; i < Assets.Num(); i++)
-    {
-        if (Assets[i].Data == Asset) 
-        {
-            Assets.RemoveAt(i);
-            i--;
-            changed = true;
-        }
-    }
-    if (changed) PrepareAssetList();
-    AssetLock.Unlock();
-    
-    if(changed) OnAssetListUpdated.ExecuteIfBound();
-}
-
-void AssetManager::BindToAssetRegistry()
-{
-    FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
-    IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
-
-    AssetRegistry.OnAssetAdded().AddSP(this, &AssetManager::OnAssetAdded);
-    AssetRegistry.OnAssetRemoved().AddSP(this, &AssetManager::OnAssetUpdated);
-    AssetRegistry.OnAssetRemoved().AddSP(this, &AssetManager::OnAssetRemoved);
-    AssetRegistry.OnAssetRenamed().AddSP(this, &AssetManager::OnAssetRenamed);
-
-    ScanAssets();
-}
-
-void AssetManager::RequestActionExecution(int ActionId, TArray<FAssetData> ActionAssets)
-{
-    FWorldContext* PIEWorldContext = GEditor->GetPIEWorldContext();
-    if (PIEWorldContext)
-    {
-        FNotificationInfo Notification(FText::FromString("Can not modify assets while Play In Editor is active"));
-        Notification.ExpireDuration = 3.0f;
-        FSlateNotificationManager::Get().AddNotification(Notification);
-
-        return;
-    }
-    
-    if(AssetActions.IsValidIndex(ActionId))
-    {
-        AssetActions[ActionId]->ExecuteAction(ActionAssets);
-    }
-}
-
-void AssetManager::FixAllRedirectors()
-{
-    FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
-    IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
-
-    FARFilter filter;
-    filter.ClassNames.Add(UObjectRedirector::StaticClass()->GetFName());
-    filter.bRecursivePaths = true;
-    filter.PackagePaths.Add("/Game");
-
-    TArray<FAssetData> Redirectors;
-    AssetRegistry.GetAssets(filter, Redirectors);
-    
-    TArray<UObjectRedirector*> Objects;
-
-    for (int32 i = 0; i < Redirectors.Num(); i++)
-    {
-        FAssetData& Asset = Redirectors[i];
-
-        FString asset_name = FPaths::GetBaseFilename(Asset.PackageName.ToString());
-
-        if (Asset.AssetName.ToString().Equals(asset_name))
-        {
-            Objects.AddUnique(static_cast<UObjectRedirector*>(Asset.GetAsset()));
-        }
-    }
-    
-    if(Objects.Num() == 0)
-    {
-        FNotificationInfo Notification(FText::FromString("No redirectors found"));
-        Notification.ExpireDuration = 2.0f;
-        FSlateNotificationManager::Get().AddNotification(Notification);
-    }
-    else 
-    {
-        FAssetToolsModule& AssetToolsModule = FModuleManager::LoadModuleChecked<FAssetToolsModule>(TEXT("AssetTools"));
-        AssetToolsModule.Get().FixupReferencers(Objects);
-
-        FNotificationInfo Notification(FText::FromString("Fixed " + FString::FromInt(Objects.Num()) +  " redirector(s)"));
-        Notification.ExpireDuration = 2.0f;
-        FSlateNotificationManager::Get().AddNotification(Notification);
-    }
-}
-
-void AssetManager::ScanAssets() //TODO perform scan on worker thread
-{
-    FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
-    IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
-
-    TArray<FAssetData> RawAssets;
-    bool res = AssetRegistry.GetAllAssets(RawAssets, true);
-
-    TArray<FAssetInfo> NewAssets;
-
-    for (FAssetData Asset : RawAssets)
-    {
-        NewAssets.Add({ Asset, {} });
-    }
-
-    ProcessAssets(NewAssets);
-
-    AssetLock.Lock();
-    Assets = NewAssets;
-    PrepareAssetList();
-    AssetLock.Unlock();
-    
-    OnAssetListUpdated.ExecuteIfBound();
-}
-
-void AssetManager::ProcessAssets(TArray<FAssetInfo>& NewAssets)
-{
-    FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
-    IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
-    
-    TArray<FAssetData> Worlds;
-    AssetRegistry.GetAssetsByClass(UWorld::StaticClass()->GetFName(), Worlds, true);
-
-    for (int32 i = 0; i < Worlds.Num(); i++)
-    {
-        FAssetData& Asset = Worlds[i];
-
-        if (!Asset.PackageName.ToString().StartsWith("/Game/", ESearchCase::IgnoreCase))
-        {
-            if (Worlds.IsValidIndex(i))
-            {
-                Worlds.RemoveAt(i);
-                i--;
-            }
-        }
-    }
-
-    for (int32 i = 0; i < NewAssets.Num(); i++)
-    {
-        FAssetData& Asset = NewAssets[i].Data;
-
-        if (!Asset.PackageName.ToString().StartsWith("/Game/", ESearchCase::IgnoreCase))
-        {
-            NewAssets.RemoveAt(i);
-            i--;
-            continue;
-        }
-
-        FString asset_name = FPaths::GetBaseFilename(Asset.PackageName.ToString());
-        
-        if(!Asset.AssetName.ToString().Equals(asset_name))
-        {
-            NewAssets.RemoveAt(i);
-            i--;
-            continue;
-        }
-    }
-
-
-
-    uint16 id = 0;
-    for (TSharedPtr<IAssetAction>& Action : AssetActions)
-    {
-        Action->ScanAssets(NewAssets, id);
-        id++;
-    }
-
-    for (int i = 0; i < NewAssets.Num(); i++)
-    {
-        if (NewAssets[i].ActionResults.Num() == 0)
-        {
-            NewAssets.RemoveAt(i);
-            i--;
-        }
-    }
-}
-
-void AssetManager::PrepareAssetList()
-{
-    Assets.Sort([](const FAssetInfo& A, const FAssetInfo& B)
-    {
-        return A.Data.PackageName < B.Data.PackageName;
-    });
-}
-
-AssetManager* AssetManager::Get()
-{
-    return instance_;
-}
+#include "AssetMagementCore.h"
+#include "AssetManagementModule.h"
+#include "AssetRegistryModule.h"
+#include "Actions/AssetActionUnusedCheck.h"
+#include "Actions/AssetActionRedirector.h"
+#include "Actions/AssetActionNamingCheck.h"
+#include "Actions/AssetActionCycleCheck.h"
+#include "Actions/AssetActionDuplicateCheck.h"
+#include "Framework/Notifications/NotificationManager.h"
+#include "Editor.h"
+#include "Widgets/Notifications/SNotificationList.h"
+#include "AssetToolsModule.h"
+#include "AssetMagementConfig.h"
+#include "AssetIndexFile.h"
+#include "RedirectorResolver.h"
+#include "AssetResultExporter.h"
+#include "AssetSuppressionIndex.h"
+#include "PackageHashCache.h"
+#include "AssetScanWorkers.h"
+#include "Misc/PackageName.h"
+#include "Features/IModularFeatures.h"
+
+AssetManager* instance_ = nullptr;
+
+AssetManager::FOnAssetListUpdated AssetManager::OnAssetListUpdated;
+
+void AssetManager::Create()
+{
+    if (instance_ != nullptr) UE_LOG(AssetManagementLog, Fatal, TEXT("AssetManager already started"))
+    instance_ = this;
+
+    AssetManagerConfig::Get().Load();
+
+    const int SortOrder = AssetManagerConfig::Get().GetInt("UI", "SortOrder", 0);
+    SortedIndex.SetOrder(static_cast<EAssetSortOrder>(FMath::Clamp(SortOrder, 0, static_cast<int>(EAssetSortOrder::Count) - 1)));
+
+    TArray<TSharedPtr<IAssetAction>> BuiltInActions;
+    BuiltInActions.Add(MakeShareable(new AssetActionUnusedCheck()));
+    BuiltInActions.Add(MakeShareable(new AssetActionNamingCheck()));
+    BuiltInActions.Add(MakeShareable(new AssetActionRedirector()));
+    BuiltInActions.Add(MakeShareable(new AssetActionCycleCheck()));
+    BuiltInActions.Add(MakeShareable(new AssetActionDuplicateCheck()));
+    AddActions(nullptr, BuiltInActions);
+
+    IModularFeatures& ModularFeatures = IModularFeatures::Get();
+    TArray<IAssetActionProvider*> Providers = ModularFeatures.GetModularFeatureImplementations<IAssetActionProvider>(IAssetActionProvider::GetModularFeatureName());
+    for (IAssetActionProvider* Provider : Providers)
+    {
+        TArray<TSharedPtr<IAssetAction>> ProvidedActions;
+        Provider->CreateActions(ProvidedActions);
+        AddActions(Provider, ProvidedActions);
+    }
+
+    ModularFeatures.OnModularFeatureRegistered().AddSP(this, &AssetManager::OnModularFeatureRegistered);
+    ModularFeatures.OnModularFeatureUnregistered().AddSP(this, &AssetManager::OnModularFeatureUnregistered);
+
+    AssetManagerConfig::OnConfigChanged.AddSP(this, &AssetManager::OnConfigChanged);
+
+    Scheduler.Start();
+
+    // Show the results of the previous session until the registry is ready to validate them
+    LoadIndex();
+    
+    FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
+    IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
+
+    if (AssetRegistry.IsLoadingAssets())
+    {
+        AssetRegistry.OnFilesLoaded().AddSP(this, &AssetManager::BindToAssetRegistry);
+    }
+    else
+    {
+        BindToAssetRegistry();
+    }
+}
+
+void AssetManager::Destroy()
+{
+    EventQueue.OnFlush.Unbind();
+    Scheduler.Stop();
+    AssetScanWorkers::Get().Shutdown();
+    if (IndexDirty) SaveIndex();
+
+    IModularFeatures::Get().OnModularFeatureRegistered().RemoveAll(this);
+    IModularFeatures::Get().OnModularFeatureUnregistered().RemoveAll(this);
+    AssetManagerConfig::OnConfigChanged.RemoveAll(this);
+
+    for(TSharedPtr<IAssetAction>& Action : AssetActions)
+    {
+        Action.Reset();
+    }
+
+    AssetActions.Empty();
+    ActionOwners.Empty();
+    
+    instance_ = nullptr;
+}
+
+TArray<FAssetInfo> AssetManager::GetAssets()
+{
+    AssetLock.Lock();
+    TArray<FAssetInfo> res = GetSortedAssets();
+    AssetLock.Unlock();
+
+    return res;
+}
+
+bool AssetManager::FindAsset(FName PackageName, FAssetInfo& OutAsset)
+{
+    AssetLock.Lock();
+    const int32* Slot = AssetSlots.Find(PackageName);
+    if (Slot != nullptr) OutAsset = Assets[*Slot];
+    AssetLock.Unlock();
+
+    return Slot != nullptr;
+}
+
+TArray<FAssetInfo> AssetManager::QueryAssets(const FAssetQuery& Query, int32 MaxResults)
+{
+    TArray<FAssetInfo> res;
+
+    AssetLock.Lock();
+    const TBitArray<> Matches = SearchIndex.Query(Query);
+
+    TArray<int32> Slots;
+    SortedIndex.GetSlots(Slots);
+    for (int32 Slot : Slots)
+    {
+        if (res.Num() >= MaxResults) break;
+        if (Slot < Matches.Num() && Matches[Slot]) res.Add(Assets[Slot]);
+    }
+    AssetLock.Unlock();
+
+    return res;
+}
+
+TArray<IAssetAction*> AssetManager::GetActions()
+{
+    TArray<IAssetAction*> actions;
+    for(TSharedPtr<IAssetAction>& Action : AssetActions)
+    {
+        actions.Add(Action.Get());
+    }
+
+    return actions;
+}
+
+void AssetManager::AddActions(IModularFeature* Owner, TArray<TSharedPtr<IAssetAction>>& NewActions)
+{
+    for (TSharedPtr<IAssetAction>& Action : NewActions)
+    {
+        if (!Action.IsValid()) continue;
+
+        AssetActions.Add(Action);
+        ActionOwners.Add(Owner);
+    }
+}
+
+void AssetManager::OnModularFeatureRegistered(const FName& Type, IModularFeature* Feature)
+{
+    if (Type != IAssetActionProvider::GetModularFeatureName()) return;
+
+    TArray<TSharedPtr<IAssetAction>> ProvidedActions;
+    static_cast<IAssetActionProvider*>(Feature)->CreateActions(ProvidedActions);
+    AddActions(Feature, ProvidedActions);
+
+    FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
+    if (ProvidedActions.Num() > 0 && !AssetRegistryModule.Get().IsLoadingAssets()) QueueScan(ASP_Incremental);
+}
+
+void AssetManager::OnModularFeatureUnregistered(const FName& Type, IModularFeature* Feature)
+{
+    if (Type != IAssetActionProvider::GetModularFeatureName()) return;
+
+    // Old id to new id, INDEX_NONE for removed actions
+    TArray<int32> NewIds;
+    int32 NextId = 0;
+    for (int32 i = 0; i < AssetActions.Num(); i++)
+    {
+        NewIds.Add(ActionOwners[i] != Feature ? NextId++ : INDEX_NONE);
+    }
+
+    if (NextId == AssetActions.Num()) return;
+
+    for (int32 i = AssetActions.Num() - 1; i >= 0; i--)
+    {
+        if (NewIds[i] != INDEX_NONE) continue;
+
+        AssetActions.RemoveAt(i);
+        ActionOwners.RemoveAt(i);
+        if (ActionFingerprints.IsValidIndex(i)) ActionFingerprints.RemoveAt(i);
+    }
+
+    // Providers usually unregister while their module shuts down, so nothing is scanned here.
+    // Results of the remaining actions stay valid, only their ids shift down
+    AssetLock.Lock();
+    TArray<FName> Emptied;
+    for (FAssetInfo& Asset : Assets)
+    {
+        TMap<uint16, FName> Results;
+        for (auto& Result : Asset.ActionResults)
+        {
+            const int32 id = NewIds.IsValidIndex(Result.Key) ? NewIds[Result.Key] : INDEX_NONE;
+            if (id != INDEX_NONE) Results.Add(static_cast<uint16>(id), Result.Value);
+        }
+
+        uint32 Suppressed = 0;
+        for (int32 i = 0; i < NewIds.Num() && i < 32; i++)
+        {
+            if (NewIds[i] != INDEX_NONE && (Asset.SuppressedActions & (1u << i)) != 0) Suppressed |= 1u << NewIds[i];
+        }
+
+        Asset.ActionResults = MoveTemp(Results);
+        Asset.SuppressedActions = Suppressed;
+        if (Asset.ActionResults.Num() == 0) Emptied.Add(Asset.Data.PackageName);
+    }
+
+    // Both indices may be keyed by action ids, they are rebuilt below instead of updated per asset. Package order only depends on the name
+    for (FName PackageName : Emptied)
+    {
+        int32 Slot = INDEX_NONE;
+        if (!AssetSlots.RemoveAndCopyValue(PackageName, Slot)) continue;
+
+        PackageOrder.Remove(Slot, Assets[Slot]);
+        Assets.RemoveAt(Slot);
+    }
+
+    SortedIndex.Reset(Assets);
+    SearchIndex.Reset(Assets);
+    IndexDirty = true;
+    AssetLock.Unlock();
+
+    QueueIndexSave();
+    OnAssetListUpdated.ExecuteIfBound();
+}
+
+TArray<int32> AssetManager::ScheduleActions(const TArray<int32>* OnlyActions, uint32& OutRequirements)
+{
+    OutRequirements = AAR_Names;
+
+    // The most expensive kind of data an action needs decides its place, whole graph actions go after per asset ones of the same cost
+    TArray<TPair<int32, int32>> Costs;
+    for (int32 i = 0; i < AssetActions.Num(); i++)
+    {
+        if (OnlyActions != nullptr && !OnlyActions->Contains(i)) continue;
+
+        const uint32 Requirements = AssetActions[i]->GetRequirements();
+        OutRequirements |= Requirements;
+
+        int32 Cost = 0;
+        for (uint32 Bits = Requirements; Bits != 0; Bits >>= 1) Cost++;
+        Costs.Add(TPair<int32, int32>(Cost * 2 + (AssetActions[i]->GetGranularity() == AAG_WholeGraph ? 1 : 0), i));
+    }
+
+    Costs.StableSort([](const TPair<int32, int32>& A, const TPair<int32, int32>& B) { return A.Key < B.Key; });
+
+    TArray<int32> Schedule;
+    for (TPair<int32, int32>& Cost : Costs)
+    {
+        Schedule.Add(Cost.Value);
+    }
+
+    return Schedule;
+}
+
+void AssetManager::RequestRescan(bool RefreshDependencies)
+{
+    if (RefreshDependencies) DependencyGraphDirty = true;
+    QueueScan(ASP_User);
+}
+
+void AssetManager::QueueScan(EAssetScanPriority Priority, float Delay)
+{
+    Scheduler.Enqueue(Priority, FName(TEXT("FullScan")), [this]() { ScanAssets(); }, Delay);
+}
+
+void AssetManager::QueueIndexSave()
+{
+    // Bursts of deltas and rescans share one write once the editor is idle, Destroy writes whatever is still pending
+    Scheduler.Enqueue(ASP_Background, FName(TEXT("SaveIndex")), [this]() { if (IndexDirty) SaveIndex(); });
+}
+
+void AssetManager::QueueRegistryDelta(const FAssetRegistryDelta& Delta)
+{
+    Scheduler.Enqueue(ASP_Incremental, NAME_None, [this, Delta]() { ApplyRegistryDelta(Delta); });
+}
+
+void AssetManager::OnConfigChanged()
+{
+    // Fingerprints are compared on a later tick, after every handler of this broadcast has run,
+    // so it does not matter whether the actions have reloaded their configuration yet
+    Scheduler.Enqueue(ASP_Incremental, FName(TEXT("ConfigChange")), [this]() { ApplyConfigChange(); });
+}
+
+void AssetManager::ApplyConfigChange()
+{
+    // Nothing has been scanned yet, the first scan uses the new configuration anyway
+    if (ActionFingerprints.Num() != AssetActions.Num()) return;
+
+    // Suppressions apply to every action
+    if (FCrc::StrCrc32(*AssetManagerConfig::Get().GetString("Actions", "Suppressions", "")) != SuppressionFingerprint)
+    {
+        ScanAssets();
+        return;
+    }
+
+    TArray<int32> Changed;
+    for (int32 i = 0; i < AssetActions.Num(); i++)
+    {
+        if (AssetActions[i]->GetConfigFingerprint() != ActionFingerprints[i]) Changed.Add(i);
+    }
+
+    if (Changed.Num() > 0) RescanActions(Changed);
+}
+
+void AssetManager::UpdateFingerprints()
+{
+    ActionFingerprints.SetNum(AssetActions.Num());
+    for (int32 i = 0; i < AssetActions.Num(); i++)
+    {
+        ActionFingerprints[i] = AssetActions[i]->GetConfigFingerprint();
+    }
+
+    SuppressionFingerprint = FCrc::StrCrc32(*AssetManagerConfig::Get().GetString("Actions", "Suppressions", ""));
+}
+
+void AssetManager::RescanActions(const TArray<int32>& ActionIds)
+{
+    FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
+    IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
+
+    TArray<FAssetData> RawAssets;
+    AssetRegistry.GetAllAssets(RawAssets, true);
+
+    TArray<FAssetInfo> NewAssets;
+    for (FAssetData& Asset : RawAssets)
+    {
+        NewAssets.Add({ Asset, {} });
+    }
+
+    ProcessAssets(NewAssets, &ActionIds);
+
+    for (int32 id : ActionIds)
+    {
+        if (ActionFingerprints.IsValidIndex(id)) ActionFingerprints[id] = AssetActions[id]->GetConfigFingerprint();
+    }
+
+    AssetLock.Lock();
+
+    // Results of the other actions are kept as they are, assets only stay listed while any action reports them
+    TArray<FAssetInfo> Merged;
+    TMap<FName, int32> MergedSlots;
+    for (const FAssetInfo& Asset : Assets)
+    {
+        FAssetInfo& Entry = Merged[Merged.Add(Asset)];
+        for (int32 id : ActionIds)
+        {
+            Entry.ActionResults.Remove(static_cast<uint16>(id));
+        }
+
+        MergedSlots.Add(Entry.Data.PackageName, Merged.Num() - 1);
+    }
+
+    for (FAssetInfo& Asset : NewAssets)
+    {
+        const int32* Slot = MergedSlots.Find(Asset.Data.PackageName);
+        if (Slot == nullptr)
+        {
+            Merged.Add(MoveTemp(Asset));
+            continue;
+        }
+
+        for (auto& Result : Asset.ActionResults)
+        {
+            Merged[*Slot].ActionResults.Add(Result.Key, Result.Value);
+        }
+    }
+
+    Merged.RemoveAll([](const FAssetInfo& Asset) { return Asset.ActionResults.Num() == 0; });
+
+    SetAssets(Merged);
+    IndexDirty = true;
+    AssetLock.Unlock();
+
+    QueueIndexSave();
+
+    OnAssetListUpdated.ExecuteIfBound();
+}
+
+void AssetManager::OnAssetAdded(const FAssetData& Asset)
+{
+    EventQueue.AddChanged(Asset.PackageName);
+}
+
+void AssetManager::OnAssetUpdated(const FAssetData& Asset)
+{
+    EventQueue.AddChanged(Asset.PackageName);
+}
+
+void AssetManager::OnAssetRenamed(const FAssetData& Asset, const FString& OldObjectPath)
+{
+    EventQueue.AddRemoved(FName(*FPackageName::ObjectPathToPackageName(OldObjectPath)));
+    EventQueue.AddChanged(Asset.PackageName);
+}
+
+void AssetManager::OnAssetRemoved(const FAssetData& Asset)
+{
+    EventQueue.AddRemoved(Asset.PackageName);
+}
+
+void AssetManager::ApplyRegistryDelta(const FAssetRegistryDelta& Delta)
+{
+    FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
+    IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
+
+    // Removed packages may still contain other assets, so both lists are resolved against the registry
+    TSet<FName> Affected;
+    TMap<FName, FAssetData> Existing;
+    TArray<FAssetInfo> NewAssets;
+    for (const TArray<FName>* PackageList : { &Delta.Changed, &Delta.Removed })
+    {
+        for (FName PackageName : *PackageList)
+        {
+            Affected.Add(PackageName);
+
+            TArray<FAssetData> PackageAssets;
+            AssetRegistry.GetAssetsByPackageName(PackageName, PackageAssets);
+            for (FAssetData& Asset : PackageAssets)
+            {
+                NewAssets.Add({ Asset, {} });
+                Existing.Add(PackageName, Asset);
+            }
+        }
+    }
+
+    // Only the rows of the affected packages are refreshed, a graph that was never built is built in full by the next scan
+    if (!DependencyGraphDirty)
+    {
+        TArray<FName> ChangedPackages;
+        TArray<FName> RemovedPackages;
+        for (FName PackageName : Affected)
+        {
+            if (!PackageName.ToString().StartsWith("/Game/", ESearchCase::IgnoreCase)) continue;
+
+            if (Existing.Contains(PackageName)) ChangedPackages.Add(PackageName);
+            else RemovedPackages.Add(PackageName);
+        }
+
+        DependencyGraph.Patch(AssetRegistry, ChangedPackages, RemovedPackages);
+    }
+
+    // Only per asset results can be computed from the changed packages alone
+    TArray<int32> PerAssetActions;
+    TArray<int32> WholeGraphActions;
+    for (int32 i = 0; i < AssetActions.Num(); i++)
+    {
+        if (AssetActions[i]->GetGranularity() == AAG_PerAsset) PerAssetActions.Add(i);
+        else WholeGraphActions.Add(i);
+    }
+
+    //TODO execute on separate thread
+    ProcessAssets(NewAssets, &PerAssetActions);
+
+    AssetLock.Lock();
+    bool changed = NewAssets.Num() > 0;
+
+    // Whole graph results of packages that still exist stay listed until the queued rescan replaces them
+    TMap<FName, FAssetInfo> Kept;
+    for (FName PackageName : Affected)
+    {
+        const int32* Slot = AssetSlots.Find(PackageName);
+        const FAssetData* Data = Existing.Find(PackageName);
+        if (Slot != nullptr && Data != nullptr)
+        {
+            FAssetInfo& Entry = Kept.Add(PackageName, { *Data, {} });
+            for (int32 id : WholeGraphActions)
+            {
+                const FName* Result = Assets[*Slot].ActionResults.Find(static_cast<uint16>(id));
+                if (Result != nullptr) Entry.ActionResults.Add(static_cast<uint16>(id), *Result);
+            }
+        }
+
+        changed |= RemoveAsset(PackageName);
+    }
+
+    for (FAssetInfo& Asset : NewAssets)
+    {
+        FAssetInfo KeptAsset;
+        if (Kept.RemoveAndCopyValue(Asset.Data.PackageName, KeptAsset))
+        {
+            for (auto& Result : KeptAsset.ActionResults)
+            {
+                Asset.ActionResults.Add(Result.Key, Result.Value);
+            }
+        }
+
+        AddAsset(Asset);
+    }
+
+    for (auto& Entry : Kept)
+    {
+        if (Entry.Value.ActionResults.Num() > 0) AddAsset(Entry.Value);
+    }
+
+    if (changed) IndexDirty = true;
+    AssetLock.Unlock();
+
+    if (changed)
+    {
+        QueueIndexSave();
+        OnAssetListUpdated.ExecuteIfBound();
+    }
+
+    // A change to one package can alter whole graph results anywhere, like unused or cyclic assets elsewhere in the project
+    if (WholeGraphActions.Num() > 0)
+    {
+        Scheduler.Enqueue(ASP_Incremental, FName(TEXT("WholeGraphRescan")), [this]() { RescanWholeGraphActions(); });
+    }
+}
+
+void AssetManager::RescanWholeGraphActions()
+{
+    // Ids are collected when the job runs, providers may have been removed since it was queued
+    TArray<int32> WholeGraphActions;
+    for (int32 i = 0; i < AssetActions.Num(); i++)
+    {
+        if (AssetActions[i]->GetGranularity() == AAG_WholeGraph) WholeGraphActions.Add(i);
+    }
+
+    if (WholeGraphActions.Num() > 0) RescanActions(WholeGraphActions);
+}
+
+void AssetManager::BindToAssetRegistry()
+{
+    FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
+    IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
+
+    EventQueue.OnFlush.BindSP(this, &AssetManager::QueueRegistryDelta);
+
+    AssetRegistry.OnAssetAdded().AddSP(this, &AssetManager::OnAssetAdded);
+    AssetRegistry.OnAssetRemoved().AddSP(this, &AssetManager::OnAssetRemoved);
+    AssetRegistry.OnAssetRenamed().AddSP(this, &AssetManager::OnAssetRenamed);
+#if ENGINE_MAJOR_VERSION >= 5
+    AssetRegistry.OnAssetUpdated().AddSP(this, &AssetManager::OnAssetUpdated);
+#endif
+
+    // The index of the previous session stays visible until the editor is idle long enough to validate it
+    QueueScan(ASP_Background);
+}
+
+void AssetManager::RequestActionExecution(int ActionId, TArray<FAssetData> ActionAssets)
+{
+    FWorldContext* PIEWorldContext = GEditor->GetPIEWorldContext();
+    if (PIEWorldContext)
+    {
+        FNotificationInfo Notification(FText::FromString("Can not modify assets while Play In Editor is active"));
+        Notification.ExpireDuration = 3.0f;
+        FSlateNotificationManager::Get().AddNotification(Notification);
+
+        return;
+    }
+    
+    if(AssetActions.IsValidIndex(ActionId))
+    {
+        AssetActions[ActionId]->ExecuteAction(ActionAssets);
+    }
+}
+
+void AssetManager::FixAllRedirectors()
+{
+    FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
+    IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
+
+    RedirectorResolver Resolver;
+    Resolver.Build(AssetRegistry);
+
+    TArray<FName> Redirectors;
+    Resolver.GetRedirectors(Redirectors);
+
+    const int32 Fixed = Resolver.Fix(Redirectors, AssetRegistry, Loader);
+    
+    if(Fixed == 0)
+    {
+        FNotificationInfo Notification(FText::FromString("No redirectors found"));
+        Notification.ExpireDuration = 2.0f;
+        FSlateNotificationManager::Get().AddNotification(Notification);
+    }
+    else 
+    {
+        FNotificationInfo Notification(FText::FromString("Fixed " + FString::FromInt(Fixed) +  " redirector(s)"));
+        Notification.ExpireDuration = 2.0f;
+        FSlateNotificationManager::Get().AddNotification(Notification);
+    }
+}
+
+bool AssetManager::ExportResults(const FString& Path)
+{
+    AssetResultExporter Exporter;
+    if (!Exporter.Begin(Path, AssetResultExporter::GetFormatForPath(Path), GetActionNames())) return false;
+
+    AssetLock.Lock();
+    TArray<int32> Slots;
+    PackageOrder.GetSlots(Slots);
+
+    for (int32 Slot : Slots)
+    {
+        Exporter.AddRow(Assets[Slot]);
+    }
+    AssetLock.Unlock();
+
+    return Exporter.End();
+}
+
+void AssetManager::ScanAssets() //TODO perform scan on worker thread
+{
+    FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
+    IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
+
+    TArray<FAssetData> RawAssets;
+    bool res = AssetRegistry.GetAllAssets(RawAssets, true);
+
+    TArray<FAssetInfo> NewAssets;
+
+    for (FAssetData Asset : RawAssets)
+    {
+        NewAssets.Add({ Asset, {} });
+    }
+
+    ProcessAssets(NewAssets);
+    UpdateFingerprints();
+
+    AssetLock.Lock();
+    SetAssets(NewAssets);
+    AssetLock.Unlock();
+
+    SaveIndex();
+    
+    OnAssetListUpdated.ExecuteIfBound();
+
+    // Optional periodic validation catches changes the registry never reported, like files replaced outside the editor
+    const int32 ValidationInterval = AssetManagerConfig::Get().GetInt("Scan", "ValidationIntervalMinutes", 0);
+    if (ValidationInterval > 0) QueueScan(ASP_Background, ValidationInterval * 60.0f);
+}
+
+void AssetManager::ProcessAssets(TArray<FAssetInfo>& NewAssets, const TArray<int32>* OnlyActions)
+{
+    const double StartTime = FPlatformTime::Seconds();
+    Loader.ResetStats();
+    Loader.SampleMemory();
+
+    FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
+    IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
+    
+    TArray<FAssetData> Worlds;
+    AssetRegistry.GetAssetsByClass(UWorld::StaticClass()->GetFName(), Worlds, true);
+
+    for (int32 i = 0; i < Worlds.Num(); i++)
+    {
+        FAssetData& Asset = Worlds[i];
+
+        if (!Asset.PackageName.ToString().StartsWith("/Game/", ESearchCase::IgnoreCase))
+        {
+            if (Worlds.IsValidIndex(i))
+            {
+                Worlds.RemoveAt(i);
+                i--;
+            }
+        }
+    }
+
+    for (int32 i = 0; i < NewAssets.Num(); i++)
+    {
+        FAssetData& Asset = NewAssets[i].Data;
+
+        if (!Asset.PackageName.ToString().StartsWith("/Game/", ESearchCase::IgnoreCase))
+        {
+            NewAssets.RemoveAt(i);
+            i--;
+            continue;
+        }
+
+        FString asset_name = FPaths::GetBaseFilename(Asset.PackageName.ToString());
+        
+        if(!Asset.AssetName.ToString().Equals(asset_name))
+        {
+            NewAssets.RemoveAt(i);
+            i--;
+            continue;
+        }
+    }
+
+    ApplySuppressions(NewAssets);
+
+    uint32 Requirements;
+    const TArray<int32> Schedule = ScheduleActions(OnlyActions, Requirements);
+
+    // Every kind of data is gathered once and shared by all actions that declared it
+    if (Requirements & AAR_Dependencies) BuildDependencyGraph();
+    UpdatePackageSizes(NewAssets);
+
+    ScanCache.Open();
+    for (int32 id : Schedule)
+    {
+        RunAction(id, NewAssets);
+    }
+
+    // Only actions that declared loaded objects queue requests, a package shared by several of them is loaded once
+    Loader.Flush();
+    Loader.SampleMemory();
+
+    const int32 NumScanned = NewAssets.Num();
+    for (int i = 0; i < NewAssets.Num(); i++)
+    {
+        // Actions that don't check the mask themselves still never report suppressed results
+        for (uint16 id = 0; NewAssets[i].SuppressedActions != 0 && id < 32; id++)
+        {
+            if (NewAssets[i].IsSuppressed(id)) NewAssets[i].ActionResults.Remove(id);
+        }
+
+        if (NewAssets[i].ActionResults.Num() == 0)
+        {
+            NewAssets.RemoveAt(i);
+            i--;
+        }
+    }
+
+    const FAssetLoadStats& Stats = Loader.GetStats();
+    UE_LOG(AssetManagementLog, Log, TEXT("Scanned %d asset(s) in %.2fs: %d with issues, %d loaded, %d GC checkpoint(s), peak memory %llu MB"),
+        NumScanned, FPlatformTime::Seconds() - StartTime, NewAssets.Num(), Stats.Loaded, Stats.Checkpoints, Stats.PeakUsedPhysical / (1024 * 1024));
+}
+
+void AssetManager::RunAction(int32 ActionId, TArray<FAssetInfo>& NewAssets)
+{
+    IAssetAction& Action = *AssetActions[ActionId];
+    const uint16 id = static_cast<uint16>(ActionId);
+
+    // Results of whole graph actions depend on other assets, they can't be keyed by a single package
+    if (!ScanCache.IsEnabled() || Action.GetGranularity() != AAG_PerAsset)
+    {
+        Action.ScanAssets(NewAssets, id);
+        return;
+    }
+
+    const FString ActionName = Action.GetFilterName();
+    const uint32 Fingerprint = Action.GetConfigFingerprint();
+
+    // Most results only depend on names and tags, the package is only read for results that depend on its contents
+    TArray<FString> Inputs;
+    Inputs.SetNum(NewAssets.Num());
+    TArray<uint8> Cacheable;
+    Cacheable.SetNumZeroed(NewAssets.Num());
+    TArray<int32> ContentIndices;
+    TArray<FString> ContentFilenames;
+    for (int32 i = 0; i < NewAssets.Num(); i++)
+    {
+        if (NewAssets[i].IsSuppressed(id)) continue;
+
+        Cacheable[i] = 1;
+        if (Action.GetCacheInputs(NewAssets[i].Data, Inputs[i]))
+        {
+            ContentIndices.Add(i);
+            ContentFilenames.Add(PackageHashCache::GetPackageFilename(NewAssets[i].Data));
+        }
+    }
+
+    // The summary changes with every save, so it stands in for the contents without reading the whole file
+    TArray<const FSHAHash*> PackageHashes;
+    PackageHashes.SetNumZeroed(NewAssets.Num());
+    if (ContentFilenames.Num() > 0)
+    {
+        PackageHashCache& HashCache = PackageHashCache::Get();
+        HashCache.Update(ContentFilenames, EPackageHashType::SummaryHash);
+        HashCache.Save();
+
+        for (int32 i = 0; i < ContentIndices.Num(); i++)
+        {
+            const FPackageHashEntry* Entry = HashCache.Find(ContentFilenames[i]);
+            if (Entry != nullptr && EnumHasAnyFlags(Entry->ValidTypes, EPackageHashType::SummaryHash)) PackageHashes[ContentIndices[i]] = &Entry->SummaryHash;
+            else Cacheable[ContentIndices[i]] = 0;
+        }
+    }
+
+    TArray<FSHAHash> Keys;
+    Keys.SetNum(NewAssets.Num());
+    TArray<uint8> Hits;
+    Hits.SetNumZeroed(NewAssets.Num());
+    TArray<uint8> HitHasResult;
+    HitHasResult.SetNumZeroed(NewAssets.Num());
+    TArray<FName> HitResults;
+    HitResults.SetNum(NewAssets.Num());
+    TArray<int32> HitDetails;
+    HitDetails.SetNum(NewAssets.Num());
+
+    // Suppressed assets and files without a hash are neither fetched nor stored
+    AssetScanWorkers::Get().ParallelFor(NewAssets.Num(), [&](int32 Index)
+    {
+        if (!Cacheable[Index]) return;
+
+        Keys[Index] = SharedScanCache::MakeKey(PackageHashes[Index], NewAssets[Index].Data.PackageName, Inputs[Index], ActionName, Fingerprint);
+
+        bool HasResult = false;
+        if (ScanCache.Fetch(Keys[Index], HasResult, HitResults[Index], HitDetails[Index]))
+        {
+            Hits[Index] = 1;
+            HitHasResult[Index] = HasResult ? 1 : 0;
+        }
+    });
+
+    TArray<FAssetInfo> Missed;
+    TArray<int32> MissedIndices;
+    int32 NumHits = 0;
+    for (int32 i = 0; i < NewAssets.Num(); i++)
+    {
+        if (Hits[i])
+        {
+            if (HitHasResult[i])
+            {
+                NewAssets[i].ActionResults.Add(id, HitResults[i]);
+                Action.RestoreResultDetail(HitResults[i], HitDetails[i]);
+            }
+
+            NumHits++;
+            continue;
+        }
+
+        if (NewAssets[i].IsSuppressed(id)) continue;
+
+        Missed.Add(NewAssets[i]);
+        MissedIndices.Add(i);
+    }
+
+    if (Missed.Num() == 0)
+    {
+        UE_LOG(AssetManagementLog, Verbose, TEXT("%s: %d result(s) from the shared cache"), *ActionName, NumHits);
+        return;
+    }
+
+    Action.ScanAssets(Missed, id);
+
+    // Requests may refer to the subset, so they are completed before it goes out of scope
+    Loader.Flush();
+
+    // Details are read here, actions don't have to be safe to call from the workers
+    TArray<int32> Details;
+    Details.SetNum(Missed.Num());
+    for (int32 i = 0; i < Missed.Num(); i++)
+    {
+        const FName* Result = Missed[i].ActionResults.Find(id);
+        if (Result != nullptr) NewAssets[MissedIndices[i]].ActionResults.Add(id, *Result);
+
+        Details[i] = Result != nullptr ? Action.GetResultDetail(*Result) : INDEX_NONE;
+    }
+
+    AssetScanWorkers::Get().ParallelFor(Missed.Num(), [&](int32 i)
+    {
+        if (!Cacheable[MissedIndices[i]]) return;
+
+        const FName* Result = Missed[i].ActionResults.Find(id);
+        ScanCache.Store(Keys[MissedIndices[i]], Result != nullptr, Result != nullptr ? *Result : NAME_None, Details[i]);
+    });
+
+    UE_LOG(AssetManagementLog, Verbose, TEXT("%s: %d result(s) from the shared cache, %d scanned"), *ActionName, NumHits, Missed.Num());
+}
+
+void AssetManager::ApplySuppressions(TArray<FAssetInfo>& NewAssets)
+{
+    SuppressedPackages.Reset();
+
+    AssetSuppressionIndex Suppressions;
+    Suppressions.Build(AssetSuppressionIndex::ParseEntries(AssetManagerConfig::Get().GetString("Actions", "Suppressions", "")), GetActionNames());
+    if (Suppressions.IsEmpty()) return;
+
+    // Packages suppressed for every action are dropped before any check runs
+    int32 Kept = 0;
+    for (int32 i = 0; i < NewAssets.Num(); i++)
+    {
+        const uint32 Mask = Suppressions.GetSuppressedActions(NewAssets[i].Data.PackageName);
+        if (Mask != 0) SuppressedPackages.Add(NewAssets[i].Data.PackageName, Mask);
+        if (Mask == AssetSuppressionIndex::AllActions) continue;
+
+        NewAssets[i].SuppressedActions = Mask;
+        if (Kept != i) NewAssets[Kept] = MoveTemp(NewAssets[i]);
+        Kept++;
+    }
+
+    NewAssets.SetNum(Kept);
+}
+
+void AssetManager::SetAssets(TArray<FAssetInfo>& NewAssets)
+{
+    Assets.Empty(NewAssets.Num());
+    AssetSlots.Empty(NewAssets.Num());
+
+    for (FAssetInfo& Asset : NewAssets)
+    {
+        const int32* Existing = AssetSlots.Find(Asset.Data.PackageName);
+        if (Existing != nullptr)
+        {
+            Assets[*Existing] = MoveTemp(Asset);
+            continue;
+        }
+
+        const int32 Slot = Assets.Add(MoveTemp(Asset));
+        AssetSlots.Add(Assets[Slot].Data.PackageName, Slot);
+    }
+
+    SortedIndex.Reset(Assets);
+    SearchIndex.Reset(Assets);
+    PackageOrder.Reset(Assets);
+}
+
+void AssetManager::AddAsset(FAssetInfo& Asset)
+{
+    // The package name of an existing slot never changes, so its place in PackageOrder stays valid
+    const int32* Existing = AssetSlots.Find(Asset.Data.PackageName);
+    if (Existing != nullptr)
+    {
+        SortedIndex.Remove(*Existing, Assets[*Existing]);
+        SearchIndex.Remove(*Existing, Assets[*Existing]);
+        Assets[*Existing] = Asset;
+        SortedIndex.Add(*Existing, Assets[*Existing]);
+        SearchIndex.Add(*Existing, Assets[*Existing]);
+        return;
+    }
+
+    const int32 Slot = Assets.Add(Asset);
+    AssetSlots.Add(Asset.Data.PackageName, Slot);
+    SortedIndex.Add(Slot, Assets[Slot]);
+    SearchIndex.Add(Slot, Assets[Slot]);
+    PackageOrder.Add(Slot, Assets[Slot]);
+}
+
+bool AssetManager::RemoveAsset(FName PackageName)
+{
+    int32 Slot = INDEX_NONE;
+    if (!AssetSlots.RemoveAndCopyValue(PackageName, Slot)) return false;
+
+    SortedIndex.Remove(Slot, Assets[Slot]);
+    SearchIndex.Remove(Slot, Assets[Slot]);
+    PackageOrder.Remove(Slot, Assets[Slot]);
+    Assets.RemoveAt(Slot);
+
+    return true;
+}
+
+TArray<FAssetInfo> AssetManager::GetSortedAssets()
+{
+    TArray<int32> Slots;
+    SortedIndex.GetSlots(Slots);
+
+    TArray<FAssetInfo> res;
+    res.Reserve(Slots.Num());
+    for (int32 Slot : Slots)
+    {
+        res.Add(Assets[Slot]);
+    }
+
+    return res;
+}
+
+void AssetManager::SetSortOrder(EAssetSortOrder Order)
+{
+    AssetLock.Lock();
+    SortedIndex.SetOrder(Order);
+    SortedIndex.Reset(Assets);
+    AssetLock.Unlock();
+
+    AssetManagerConfig::Get().SetInt("UI", "SortOrder", static_cast<int>(Order));
+
+    OnAssetListUpdated.ExecuteIfBound();
+}
+
+EAssetSortOrder AssetManager::GetSortOrder()
+{
+    AssetLock.Lock();
+    EAssetSortOrder Order = SortedIndex.GetOrder();
+    AssetLock.Unlock();
+
+    return Order;
+}
+
+void AssetManager::UpdatePackageSizes(TArray<FAssetInfo>& NewAssets) const
+{
+    for (FAssetInfo& Asset : NewAssets)
+    {
+        const int32 Node = DependencyGraph.FindNode(Asset.Data.PackageName);
+        Asset.PackageSize = Node != INDEX_NONE ? DependencyGraph.GetPackageSize(Node) : 0;
+    }
+}
+
+void AssetManager::BuildDependencyGraph()
+{
+    if (!DependencyGraphDirty) return;
+    DependencyGraphDirty = false;
+
+    FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
+    IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
+
+    FARFilter filter;
+    filter.bRecursivePaths = true;
+    filter.PackagePaths.Add("/Game");
+
+    TArray<FAssetData> GameAssets;
+    AssetRegistry.GetAssets(filter, GameAssets);
+
+    TSet<FName> UniquePackages;
+    TArray<FName> PackageNames;
+    for (FAssetData& Asset : GameAssets)
+    {
+        bool AlreadyAdded = false;
+        UniquePackages.Add(Asset.PackageName, &AlreadyAdded);
+        if (!AlreadyAdded) PackageNames.Add(Asset.PackageName);
+    }
+
+    DependencyGraph.Build(AssetRegistry, PackageNames);
+}
+
+void AssetManager::LoadIndex()
+{
+    if (!AssetManagerConfig::Get().GetBool("Scan", "PersistentIndex", true)) return;
+
+    AssetIndexFile Index;
+    if (!Index.Open(AssetIndexFile::GetDefaultPath())) return;
+
+    TArray<FAssetInfo> IndexedAssets;
+    Index.ReadAssets(GetActionNames(), IndexedAssets);
+    Index.ReadGraph(DependencyGraph);
+    UpdatePackageSizes(IndexedAssets);
+
+    AssetLock.Lock();
+    SetAssets(IndexedAssets);
+    AssetLock.Unlock();
+
+    OnAssetListUpdated.ExecuteIfBound();
+}
+
+void AssetManager::SaveIndex()
+{
+    if (!AssetManagerConfig::Get().GetBool("Scan", "PersistentIndex", true)) return;
+
+    AssetLock.Lock();
+    TArray<int32> Slots;
+    PackageOrder.GetSlots(Slots);
+    bool res = AssetIndexFile::Write(AssetIndexFile::GetDefaultPath(), Assets, Slots, DependencyGraph, GetActionNames());
+    IndexDirty = false;
+    AssetLock.Unlock();
+
+    if (!res) UE_LOG(AssetManagementLog, Warning, TEXT("Failed to write asset index to %s"), *AssetIndexFile::GetDefaultPath());
+}
+
+TArray<FString> AssetManager::GetActionNames()
+{
+    TArray<FString> Names;
+    for (TSharedPtr<IAssetAction>& Action : AssetActions)
+    {
+        Names.Add(Action->GetFilterName());
+    }
+
+    return Names;
+}
+
+AssetManager* AssetManager::Get()
+{
+    return instance_;
+}
@@ -1,40 +1,113 @@
-#pragma once
-#include "AssetAction.h"
-
-class AssetManager : public TSharedFromThis<AssetManager>
-{
-public:
-    static AssetManager* Get();
-    
-    void Create();
-    void Destroy();
-
-    DECLARE_DELEGATE(FOnAssetListUpdated)
-    static FOnAssetListUpdated OnAssetListUpdated;
-
-    TArray<FAssetInfo> GetAssets();
-    TArray<IAssetAction*> GetActions();
-
-    void RequestRescan();
-
-    void OnAssetAdded(const FAssetData&);
-    void OnAssetUpdated(const FAssetData&);
-    void OnAssetRenamed(const FAssetData&, const FString&);
-    void OnAssetRemoved(const FAssetData&);
-
-    void BindToAssetRegistry();
-
-    void RequestActionExecution(int ActionId, TArray<FAssetData> Assets);
-
-    void FixAllRedirectors();
-
-private:
-    void ScanAssets();
-    void ProcessAssets(TArray<FAssetInfo>&);
-    void PrepareAssetList();
-
-    TArray<TSharedPtr<IAssetAction>> AssetActions;
-    
-    TArray<FAssetInfo> Assets;
-    FCriticalSection AssetLock;
-};
+#pragma once
+#include "AssetAction.h"
+#include "AssetDependencyGraph.h"
+#include "AssetRegistryEventQueue.h"
+#include "AssetSortedIndex.h"
+#include "AssetSearchIndex.h"
+#include "AssetLoader.h"
+#include "SharedScanCache.h"
+#include "AssetScanScheduler.h"
+
+class AssetManager : public TSharedFromThis<AssetManager>
+{
+public:
+    static AssetManager* Get();
+    
+    void Create();
+    void Destroy();
+
+    DECLARE_DELEGATE(FOnAssetListUpdated)
+    static FOnAssetListUpdated OnAssetListUpdated;
+
+    TArray<FAssetInfo> GetAssets();
+    bool FindAsset(FName PackageName, FAssetInfo& OutAsset);
+
+    // Matching assets in list order, stops after MaxResults
+    TArray<FAssetInfo> QueryAssets(const FAssetQuery& Query, int32 MaxResults);
+
+    // Changing the order sorts once, later registry changes keep it up to date
+    void SetSortOrder(EAssetSortOrder Order);
+    EAssetSortOrder GetSortOrder();
+    TArray<IAssetAction*> GetActions();
+    const AssetDependencyGraph& GetDependencyGraph() const { return DependencyGraph; }
+    // Suppression masks of the packages in the current scan, including packages skipped for every action
+    const TMap<FName, uint32>& GetSuppressedPackages() const { return SuppressedPackages; }
+
+    // Actions queue the objects they need during a scan, everything is loaded once all actions have run
+    AssetLoader& GetLoader() { return Loader; }
+
+    // Dependencies are only refreshed when the registry changed, unless explicitly requested. Runs ahead of all other queued scan work
+    void RequestRescan(bool RefreshDependencies = false);
+
+    void OnAssetAdded(const FAssetData&);
+    void OnAssetUpdated(const FAssetData&);
+    void OnAssetRenamed(const FAssetData&, const FString&);
+    void OnAssetRemoved(const FAssetData&);
+
+    void BindToAssetRegistry();
+
+    void RequestActionExecution(int ActionId, TArray<FAssetData> Assets);
+
+    void FixAllRedirectors();
+
+    // Rows are written in package name order, so exports of different runs can be diffed line by line
+    bool ExportResults(const FString& Path);
+
+private:
+    void ScanAssets();
+    // Full scans share one queue entry, so repeated requests only scan once
+    void QueueScan(EAssetScanPriority Priority, float Delay = 0.0f);
+    void QueueRegistryDelta(const FAssetRegistryDelta& Delta);
+    void QueueIndexSave();
+    // Runs every action, or only the given ones
+    void ProcessAssets(TArray<FAssetInfo>&, const TArray<int32>* OnlyActions = nullptr);
+    // Reruns the given actions over all assets and replaces only their results
+    void RescanActions(const TArray<int32>& ActionIds);
+    void RescanWholeGraphActions();
+    void OnConfigChanged();
+    void ApplyConfigChange();
+    void UpdateFingerprints();
+    void ApplyRegistryDelta(const FAssetRegistryDelta& Delta);
+    void AddActions(IModularFeature* Owner, TArray<TSharedPtr<IAssetAction>>& NewActions);
+    void OnModularFeatureRegistered(const FName& Type, IModularFeature* Feature);
+    void OnModularFeatureUnregistered(const FName& Type, IModularFeature* Feature);
+    TArray<int32> ScheduleActions(const TArray<int32>* OnlyActions, uint32& OutRequirements);
+    // Per asset actions reuse results from the shared cache and only scan the assets that missed
+    void RunAction(int32 ActionId, TArray<FAssetInfo>& NewAssets);
+    void SetAssets(TArray<FAssetInfo>& NewAssets);
+    void AddAsset(FAssetInfo& Asset);
+    bool RemoveAsset(FName PackageName);
+    TArray<FAssetInfo> GetSortedAssets();
+    void UpdatePackageSizes(TArray<FAssetInfo>& NewAssets) const;
+    void ApplySuppressions(TArray<FAssetInfo>& NewAssets);
+    void BuildDependencyGraph();
+
+    void LoadIndex();
+    void SaveIndex();
+    TArray<FString> GetActionNames();
+
+    // Ids are indices into AssetActions, owners are the providers that created them or null for the built in actions
+    TArray<TSharedPtr<IAssetAction>> AssetActions;
+    TArray<IModularFeature*> ActionOwners;
+    // Configuration the current results were computed with, empty until the first full scan
+    TArray<uint32> ActionFingerprints;
+    uint32 SuppressionFingerprint = 0;
+    AssetDependencyGraph DependencyGraph;
+    AssetRegistryEventQueue EventQueue;
+    TMap<FName, uint32> SuppressedPackages;
+    
+    // Slots stay valid until their asset is removed, freed slots are reused by the next insert
+    TSparseArray<FAssetInfo> Assets;
+    TMap<FName, int32> AssetSlots;
+    AssetSortedIndex SortedIndex;
+    // Always in path order, snapshots and exports are written in it so they can be merged in linear time
+    AssetSortedIndex PackageOrder;
+    AssetSearchIndex SearchIndex;
+    AssetLoader Loader;
+    AssetScanScheduler Scheduler;
+    SharedScanCache ScanCache;
+    FCriticalSection AssetLock;
+
+    bool IndexDirty = false;
+    bool DependencyGraphDirty = true;
+};
@@ -1,60 +1,94 @@
-#include "AssetManagementCommands.h"
-#include "Framework/Commands/UICommandList.h"
-#include "Framework/MultiBox/MultiBoxBuilder.h"
-#include "Modules/ModuleManager.h"
-#include "EditorStyleSet.h"
-#include "LevelEditor.h"
-#include "AssetMagementCore.h"
-
-#define LOCTEXT_NAMESPACE "AssetManagementModule"
-
-#if ENGINE_MINOR_VERSION > 25
-    #define CompatibleInvokeTab TryInvokeTab
-#else
-    #define CompatibleInvokeTab InvokeTab
-#endif
-
-TSharedPtr<FUICommandList> AssetManagementCommands::menu_commands;
-
-
-AssetManagementCommands::AssetManagementCommands() : TCommands<AssetManagementCommands>("", FText(), "", FEditorStyle::GetStyleSetName())
-{
-}
-
-void AssetManagementCommands::RegisterCommands()
-{
-    UI_COMMAND(open_assetmanager, "Asset Manager", "", EUserInterfaceActionType::Button, FInputChord());
-    UI_COMMAND(execute_fixredirectors, "Fix all redirectors", "", EUserInterfaceActionType::Button, FInputChord());
-}
-
-
-void AssetManagementCommands::BindCommands()
-{
-    menu_commands = MakeShareable(new FUICommandList);
-    const AssetManagementCommands& Commands = AssetManagementCommands::Get();
-
-    FUICommandList& menu_actions = *menu_commands;
-    menu_actions.MapAction(Commands.open_assetmanager, FExecuteAction::CreateLambda([]() { FModuleManager::LoadModuleChecked<FLevelEditorModule>("LevelEditor").GetLevelEditorTabManager()->CompatibleInvokeTab(assetmanager_tab); }));
-    menu_actions.MapAction(Commands.execute_fixredirectors, FExecuteAction::CreateLambda([]()
-    {
-        AssetManager* manager = AssetManager::Get();
-        
-        if (manager != nullptr)
-        {
-            manager->FixAllRedirectors();
-        }
-    }));
-}
-
-void AssetManagementCommands::BuildMenu(FMenuBarBuilder& MenuBuilder)
-{
-    MenuBuilder.AddPullDownMenu(FText::FromString("Asset Tools"), FText::FromString("Open asset tools"), FNewMenuDelegate::CreateStatic(&AssetManagementCommands::MakeMenu), "Asset Tools");
-}
-
-void AssetManagementCommands::MakeMenu(FMenuBuilder& MenuBuilder)
-{
-    MenuBuilder.AddMenuEntry(AssetManagementCommands::Get().open_assetmanager);
-    MenuBuilder.AddMenuEntry(AssetManagementCommands::Get().execute_fixredirectors);
-}
-
-#undef LOCTEXT_NAMESPACE
+#include "AssetManagementCommands.h"
+#include "Framework/Commands/UICommandList.h"
+#include "Framework/MultiBox/MultiBoxBuilder.h"
+#include "Modules/ModuleManager.h"
+#include "EditorStyleSet.h"
+#include "LevelEditor.h"
+#include "AssetMagementCore.h"
+#include "DesktopPlatformModule.h"
+#include "IDesktopPlatform.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Framework/Notifications/NotificationManager.h"
+#include "Widgets/Notifications/SNotificationList.h"
+#include "Misc/Paths.h"
+
+#define LOCTEXT_NAMESPACE "AssetManagementModule"
+
+#if ENGINE_MINOR_VERSION > 25
+    #define CompatibleInvokeTab TryInvokeTab
+#else
+    #define CompatibleInvokeTab InvokeTab
+#endif
+
+TSharedPtr<FUICommandList> AssetManagementCommands::menu_commands;
+
+
+AssetManagementCommands::AssetManagementCommands() : TCommands<AssetManagementCommands>("", FText(), "", FEditorStyle::GetStyleSetName())
+{
+}
+
+void AssetManagementCommands::RegisterCommands()
+{
+    UI_COMMAND(open_assetmanager, "Asset Manager", "", EUserInterfaceActionType::Button, FInputChord());
+    UI_COMMAND(execute_fixredirectors, "Fix all redirectors", "", EUserInterfaceActionType::Button, FInputChord());
+    UI_COMMAND(execute_exportresults, "Export scan results...", "Write the current results as CSV, NDJSON or columnar binary", EUserInterfaceActionType::Button, FInputChord());
+}
+
+
+void AssetManagementCommands::BindCommands()
+{
+    menu_commands = MakeShareable(new FUICommandList);
+    const AssetManagementCommands& Commands = AssetManagementCommands::Get();
+
+    FUICommandList& menu_actions = *menu_commands;
+    menu_actions.MapAction(Commands.open_assetmanager, FExecuteAction::CreateLambda([]() { FModuleManager::LoadModuleChecked<FLevelEditorModule>("LevelEditor").GetLevelEditorTabManager()->CompatibleInvokeTab(assetmanager_tab); }));
+    menu_actions.MapAction(Commands.execute_fixredirectors, FExecuteAction::CreateLambda([]()
+    {
+        AssetManager* manager = AssetManager::Get();
+        
+        if (manager != nullptr)
+        {
+            manager->FixAllRedirectors();
+        }
+    }));
+    menu_actions.MapAction(Commands.execute_exportresults, FExecuteAction::CreateStatic(&AssetManagementCommands::ExportResults));
+}
+
+void AssetManagementCommands::ExportResults()
+{
+    AssetManager* manager = AssetManager::Get();
+    IDesktopPlatform* DesktopPlatform = FDesktopPlatformModule::Get();
+    if (manager == nullptr || DesktopPlatform == nullptr) return;
+
+    TArray<FString> Filenames;
+    const bool Selected = DesktopPlatform->SaveFileDialog(
+        FSlateApplication::Get().FindBestParentWindowHandleForDialogs(nullptr),
+        TEXT("Export scan results"),
+        FPaths::ProjectSavedDir(),
+        TEXT("AssetResults.csv"),
+        TEXT("CSV (*.csv)|*.csv|NDJSON (*.ndjson)|*.ndjson|Columnar binary (*.amr)|*.amr"),
+        EFileDialogFlags::None,
+        Filenames);
+
+    if (!Selected || Filenames.Num() == 0) return;
+
+    const bool Exported = manager->ExportResults(Filenames[0]);
+
+    FNotificationInfo Notification(FText::FromString(Exported ? "Exported scan results to " + FPaths::GetCleanFilename(Filenames[0]) : "Failed to export scan results"));
+    Notification.ExpireDuration = 3.0f;
+    FSlateNotificationManager::Get().AddNotification(Notification);
+}
+
+void AssetManagementCommands::BuildMenu(FMenuBarBuilder& MenuBuilder)
+{
+    MenuBuilder.AddPullDownMenu(FText::FromString("Asset Tools"), FText::FromString("Open asset tools"), FNewMenuDelegate::CreateStatic(&AssetManagementCommands::MakeMenu), "Asset Tools");
+}
+
+void AssetManagementCommands::MakeMenu(FMenuBuilder& MenuBuilder)
+{
+    MenuBuilder.AddMenuEntry(AssetManagementCommands::Get().open_assetmanager);
+    MenuBuilder.AddMenuEntry(AssetManagementCommands::Get().execute_fixredirectors);
+    MenuBuilder.AddMenuEntry(AssetManagementCommands::Get().execute_exportresults);
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,72 @@
+#include "AssetRegistryEventQueue.h"
+#include "AssetMagementConfig.h"
+#include "Editor.h"
+
+AssetRegistryEventQueue::~AssetRegistryEventQueue()
+{
+    if (GEditor != nullptr && FlushTimer.IsValid())
+    {
+        GEditor->GetTimerManager()->ClearTimer(FlushTimer);
+    }
+}
+
+void AssetRegistryEventQueue::AddChanged(FName PackageName)
+{
+    Pending.Add(PackageName, true);
+    Schedule();
+}
+
+void AssetRegistryEventQueue::AddRemoved(FName PackageName)
+{
+    Pending.Add(PackageName, false);
+    Schedule();
+}
+
+void AssetRegistryEventQueue::Flush()
+{
+    if (GEditor != nullptr)
+    {
+        GEditor->GetTimerManager()->ClearTimer(FlushTimer);
+    }
+
+    if (Pending.Num() == 0) return;
+
+    FAssetRegistryDelta Delta;
+    for (auto& Entry : Pending)
+    {
+        if (Entry.Value) Delta.Changed.Add(Entry.Key);
+        else Delta.Removed.Add(Entry.Key);
+    }
+    Pending.Empty();
+
+    OnFlush.ExecuteIfBound(Delta);
+}
+
+void AssetRegistryEventQueue::Schedule()
+{
+    if (GEditor == nullptr)
+    {
+        Flush();
+        return;
+    }
+
+    TSharedRef<FTimerManager> TimerManager = GEditor->GetTimerManager();
+    const double Now = FPlatformTime::Seconds();
+
+    if (!TimerManager->IsTimerActive(FlushTimer))
+    {
+        FirstEventTime = Now;
+    }
+
+    // Every new event pushes the flush back, up to a maximum delay so a long import still shows progress
+    const float Window = AssetManagerConfig::Get().GetInt("Scan", "EventBatchWindowMs", 500) / 1000.0f;
+    const float MaxDelay = AssetManagerConfig::Get().GetInt("Scan", "EventBatchMaxDelayMs", 5000) / 1000.0f;
+
+    if (Window <= 0.0f || Now - FirstEventTime >= MaxDelay)
+    {
+        Flush();
+        return;
+    }
+
+    TimerManager->SetTimer(FlushTimer, FTimerDelegate::CreateRaw(this, &AssetRegistryEventQueue::Flush), Window, false);
+}
@@ -0,0 +1,34 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "TimerManager.h"
+
+// Net result of a batch of registry notifications, every package appears at most once
+struct FAssetRegistryDelta
+{
+    TArray<FName> Changed;
+    TArray<FName> Removed;
+};
+
+// Collects asset registry notifications over a short window and hands them over as a single delta
+class AssetRegistryEventQueue
+{
+public:
+    DECLARE_DELEGATE_OneParam(FOnFlush, const FAssetRegistryDelta&)
+    FOnFlush OnFlush;
+
+    ~AssetRegistryEventQueue();
+
+    void AddChanged(FName PackageName);
+    void AddRemoved(FName PackageName);
+
+    void Flush();
+
+private:
+    void Schedule();
+
+    // Latest state per package, false means the package was removed
+    TMap<FName, bool> Pending;
+
+    FTimerHandle FlushTimer;
+    double FirstEventTime = 0.0;
+};
@@ -0,0 +1,261 @@
+#include "AssetResultExporter.h"
+#include "AssetManagementModule.h"
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
+
+#define EXPORT_MAGIC 0x414D5258
+#define EXPORT_VERSION 1
+#define EXPORT_TEXT_BUFFER_SIZE 65536
+#define EXPORT_BLOCK_ROWS 65536
+#define EXPORT_MAX_ACTIONS 32
+
+// Columnar layout, all values little endian:
+//   uint32 Magic, uint32 Version, uint32 NumActions, NumActions strings
+//   Blocks until a block with 0 rows:
+//     uint32 NumRows, uint32 NumNewStrings, NumNewStrings strings appended to the dictionary
+//     uint32 PackagePath[NumRows], uint32 AssetName[NumRows], uint32 AssetClass[NumRows]
+//     int64 PackageSize[NumRows], uint32 ResultBits[NumRows]
+//     uint32 NumPayloads, uint32 Payload[NumPayloads], one per set result bit in row order
+//   Strings are a uint32 byte count followed by UTF-8
+
+AssetResultExporter::~AssetResultExporter()
+{
+    if (Writer.IsValid())
+    {
+        Writer.Reset();
+        IFileManager::Get().Delete(*TempPath);
+    }
+}
+
+EAssetExportFormat AssetResultExporter::GetFormatForPath(const FString& Path)
+{
+    const FString Extension = FPaths::GetExtension(Path);
+    if (Extension.Equals("csv", ESearchCase::IgnoreCase)) return EAssetExportFormat::Csv;
+    if (Extension.Equals("ndjson", ESearchCase::IgnoreCase) || Extension.Equals("json", ESearchCase::IgnoreCase)) return EAssetExportFormat::NdJson;
+
+    return EAssetExportFormat::Columnar;
+}
+
+static void WriteString(FArchive& Writer, const FString& Value)
+{
+    FTCHARToUTF8 Converter(*Value);
+    uint32 Length = Converter.Length();
+    Writer << Length;
+    Writer.Serialize(const_cast<ANSICHAR*>(Converter.Get()), Length);
+}
+
+bool AssetResultExporter::Begin(const FString& InPath, EAssetExportFormat InFormat, const TArray<FString>& ActionNames)
+{
+    Path = InPath;
+    Format = InFormat;
+    Actions = ActionNames;
+
+    // Only the columnar result bitmask is limited, text formats keep a column per action
+    if (Format == EAssetExportFormat::Columnar && Actions.Num() > EXPORT_MAX_ACTIONS)
+    {
+        UE_LOG(AssetManagementLog, Warning, TEXT("Columnar export only holds %d actions, results of %d action(s) are left out"), EXPORT_MAX_ACTIONS, Actions.Num() - EXPORT_MAX_ACTIONS);
+        Actions.SetNum(EXPORT_MAX_ACTIONS);
+    }
+
+    // Written next to the target, a failed export never replaces the previous file
+    TempPath = Path + TEXT(".tmp");
+    Writer.Reset(IFileManager::Get().CreateFileWriter(*TempPath));
+    if (!Writer.IsValid()) return false;
+
+    switch (Format)
+    {
+    case EAssetExportFormat::Csv:
+        TextBuffer = "PackageName,AssetClass,PackageSize";
+        for (const FString& Action : Actions)
+        {
+            TextBuffer += "," + EscapeCsv(Action);
+        }
+        TextBuffer += "\n";
+        break;
+
+    case EAssetExportFormat::NdJson:
+        break;
+
+    case EAssetExportFormat::Columnar:
+    {
+        uint32 Magic = EXPORT_MAGIC;
+        uint32 Version = EXPORT_VERSION;
+        uint32 NumActions = Actions.Num();
+        *Writer << Magic << Version << NumActions;
+        for (const FString& Action : Actions)
+        {
+            WriteString(*Writer, Action);
+        }
+        break;
+    }
+    }
+
+    return true;
+}
+
+void AssetResultExporter::AddRow(const FAssetInfo& Asset)
+{
+    if (!Writer.IsValid()) return;
+
+    if (Format == EAssetExportFormat::Columnar) AddColumnarRow(Asset);
+    else AddTextRow(Asset);
+}
+
+bool AssetResultExporter::End()
+{
+    if (!Writer.IsValid()) return false;
+
+    if (Format == EAssetExportFormat::Columnar)
+    {
+        FlushBlock();
+
+        uint32 EndMarker = 0;
+        *Writer << EndMarker;
+    }
+    else
+    {
+        FlushText();
+    }
+
+    const bool Success = !Writer->IsError() && Writer->Close();
+    Writer.Reset();
+
+    return Success && IFileManager::Get().Move(*Path, *TempPath, true);
+}
+
+void AssetResultExporter::AddTextRow(const FAssetInfo& Asset)
+{
+    if (Format == EAssetExportFormat::Csv)
+    {
+        TextBuffer += EscapeCsv(Asset.Data.PackageName.ToString()) + "," + EscapeCsv(Asset.Data.AssetClass.ToString()) + "," + LexToString(Asset.PackageSize);
+        for (int32 Action = 0; Action < Actions.Num(); Action++)
+        {
+            const FName* Result = Asset.ActionResults.Find(Action);
+            TextBuffer += ",";
+            if (Result != nullptr) TextBuffer += EscapeCsv(Result->ToString());
+        }
+        TextBuffer += "\n";
+    }
+    else
+    {
+        TextBuffer += "{\"package\":\"" + EscapeJson(Asset.Data.PackageName.ToString()) + "\",\"class\":\"" + EscapeJson(Asset.Data.AssetClass.ToString()) + "\",\"size\":" + LexToString(Asset.PackageSize) + ",\"results\":{";
+
+        bool First = true;
+        for (int32 Action = 0; Action < Actions.Num(); Action++)
+        {
+            const FName* Result = Asset.ActionResults.Find(Action);
+            if (Result == nullptr) continue;
+
+            if (!First) TextBuffer += ",";
+            TextBuffer += "\"" + EscapeJson(Actions[Action]) + "\":\"" + EscapeJson(Result->ToString()) + "\"";
+            First = false;
+        }
+        TextBuffer += "}}\n";
+    }
+
+    if (TextBuffer.Len() >= EXPORT_TEXT_BUFFER_SIZE) FlushText();
+}
+
+void AssetResultExporter::AddColumnarRow(const FAssetInfo& Asset)
+{
+    PathColumn.Add(Intern(Asset.Data.PackagePath));
+    NameColumn.Add(Intern(Asset.Data.AssetName));
+    ClassColumn.Add(Intern(Asset.Data.AssetClass));
+    SizeColumn.Add(Asset.PackageSize);
+
+    uint32 ResultBits = 0;
+    for (int32 Action = 0; Action < Actions.Num(); Action++)
+    {
+        const FName* Result = Asset.ActionResults.Find(Action);
+        if (Result == nullptr) continue;
+
+        ResultBits |= 1u << Action;
+        PayloadColumn.Add(Intern(*Result));
+    }
+    ResultBitsColumn.Add(ResultBits);
+
+    if (PathColumn.Num() >= EXPORT_BLOCK_ROWS) FlushBlock();
+}
+
+void AssetResultExporter::FlushText()
+{
+    if (TextBuffer.Len() == 0) return;
+
+    FTCHARToUTF8 Converter(*TextBuffer);
+    Writer->Serialize(const_cast<ANSICHAR*>(Converter.Get()), Converter.Length());
+    TextBuffer.Reset();
+}
+
+void AssetResultExporter::FlushBlock()
+{
+    uint32 NumRows = PathColumn.Num();
+    if (NumRows == 0) return;
+
+    uint32 NumNewStrings = NewStrings.Num();
+    *Writer << NumRows << NumNewStrings;
+    for (FName& Value : NewStrings)
+    {
+        WriteString(*Writer, Value.ToString());
+    }
+
+    Writer->Serialize(PathColumn.GetData(), PathColumn.Num() * sizeof(uint32));
+    Writer->Serialize(NameColumn.GetData(), NameColumn.Num() * sizeof(uint32));
+    Writer->Serialize(ClassColumn.GetData(), ClassColumn.Num() * sizeof(uint32));
+    Writer->Serialize(SizeColumn.GetData(), SizeColumn.Num() * sizeof(int64));
+    Writer->Serialize(ResultBitsColumn.GetData(), ResultBitsColumn.Num() * sizeof(uint32));
+
+    uint32 NumPayloads = PayloadColumn.Num();
+    *Writer << NumPayloads;
+    Writer->Serialize(PayloadColumn.GetData(), PayloadColumn.Num() * sizeof(uint32));
+
+    NewStrings.Reset();
+    PathColumn.Reset();
+    NameColumn.Reset();
+    ClassColumn.Reset();
+    SizeColumn.Reset();
+    ResultBitsColumn.Reset();
+    PayloadColumn.Reset();
+}
+
+uint32 AssetResultExporter::Intern(FName Value)
+{
+    const uint32* Existing = Dictionary.Find(Value);
+    if (Existing != nullptr) return *Existing;
+
+    const uint32 Id = Dictionary.Num();
+    Dictionary.Add(Value, Id);
+    NewStrings.Add(Value);
+    return Id;
+}
+
+FString AssetResultExporter::EscapeCsv(const FString& Value)
+{
+    int32 Index;
+    if (!Value.FindChar(',', Index) && !Value.FindChar('"', Index) && !Value.FindChar('\n', Index)) return Value;
+
+    return "\"" + Value.Replace(TEXT("\""), TEXT("\"\"")) + "\"";
+}
+
+FString AssetResultExporter::EscapeJson(const FString& Value)
+{
+    FString Result;
+    Result.Reserve(Value.Len());
+
+    for (int32 i = 0; i < Value.Len(); i++)
+    {
+        const TCHAR Char = Value[i];
+        switch (Char)
+        {
+        case '"': Result += TEXT("\\\""); break;
+        case '\\': Result += TEXT("\\\\"); break;
+        case '\n': Result += TEXT("\\n"); break;
+        case '\r': Result += TEXT("\\r"); break;
+        case '\t': Result += TEXT("\\t"); break;
+        default:
+            if (Char < 0x20) Result += FString::Printf(TEXT("\\u%04x"), static_cast<int32>(Char));
+            else Result.AppendChar(Char);
+        }
+    }
+
+    return Result;
+}
@@ -0,0 +1,52 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "AssetAction.h"
+
+enum class EAssetExportFormat : uint8
+{
+    Csv,
+    NdJson,
+    Columnar    // Blocks of columns with a dictionary for all strings, see AssetResultExporter.cpp for the layout
+};
+
+// Writes scan results row by row, only one block of rows is kept in memory
+class AssetResultExporter
+{
+public:
+    ~AssetResultExporter();
+
+    // The format is picked from the extension, .csv, .ndjson/.json or anything else for the columnar format
+    static EAssetExportFormat GetFormatForPath(const FString& Path);
+
+    bool Begin(const FString& Path, EAssetExportFormat Format, const TArray<FString>& ActionNames);
+    void AddRow(const FAssetInfo& Asset);
+    bool End();
+
+private:
+    void AddTextRow(const FAssetInfo& Asset);
+    void AddColumnarRow(const FAssetInfo& Asset);
+    void FlushText();
+    void FlushBlock();
+    uint32 Intern(FName Value);
+
+    static FString EscapeCsv(const FString& Value);
+    static FString EscapeJson(const FString& Value);
+
+    TUniquePtr<FArchive> Writer;
+    FString TempPath;
+    FString Path;
+    EAssetExportFormat Format = EAssetExportFormat::Csv;
+    TArray<FString> Actions;
+
+    FString TextBuffer;
+
+    // Columns of the current block, strings are written once when they are first used
+    TMap<FName, uint32> Dictionary;
+    TArray<FName> NewStrings;
+    TArray<uint32> PathColumn;
+    TArray<uint32> NameColumn;
+    TArray<uint32> ClassColumn;
+    TArray<int64> SizeColumn;
+    TArray<uint32> ResultBitsColumn;
+    TArray<uint32> PayloadColumn;
+};
@@ -0,0 +1,106 @@
+#include "AssetScanScheduler.h"
+#include "AssetMagementConfig.h"
+#include "AssetManagementModule.h"
+#include "Editor.h"
+#include "Framework/Application/SlateApplication.h"
+
+#define FRAME_TIME_SMOOTHING 0.1f
+
+void AssetScanScheduler::Start()
+{
+    if (TickHandle.IsValid()) return;
+
+#if ENGINE_MAJOR_VERSION >= 5
+    TickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &AssetScanScheduler::Tick));
+#else
+    TickHandle = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &AssetScanScheduler::Tick));
+#endif
+}
+
+void AssetScanScheduler::Stop()
+{
+    if (TickHandle.IsValid())
+    {
+#if ENGINE_MAJOR_VERSION >= 5
+        FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+#else
+        FTicker::GetCoreTicker().RemoveTicker(TickHandle);
+#endif
+        TickHandle.Reset();
+    }
+
+    Jobs.Empty();
+}
+
+void AssetScanScheduler::Enqueue(EAssetScanPriority Priority, FName Key, FJob Job, float Delay)
+{
+    const double StartTime = FPlatformTime::Seconds() + Delay;
+
+    if (!Key.IsNone())
+    {
+        for (FQueuedJob& Queued : Jobs)
+        {
+            if (Queued.Key != Key) continue;
+
+            Queued.Priority = FMath::Min(Queued.Priority, Priority);
+            Queued.StartTime = FMath::Min(Queued.StartTime, StartTime);
+            Queued.Job = MoveTemp(Job);
+            return;
+        }
+    }
+
+    FQueuedJob& Queued = Jobs[Jobs.AddDefaulted()];
+    Queued.Priority = Priority;
+    Queued.Key = Key;
+    Queued.Job = MoveTemp(Job);
+    Queued.StartTime = StartTime;
+}
+
+bool AssetScanScheduler::Tick(float DeltaTime)
+{
+    AverageFrameTime = FMath::Lerp(AverageFrameTime, DeltaTime, FRAME_TIME_SMOOTHING);
+
+    if (Jobs.Num() == 0) return true;
+
+    const double Now = FPlatformTime::Seconds();
+    const bool Playing = IsPlayingInEditor();
+
+    int32 Next = INDEX_NONE;
+    for (int32 i = 0; i < Jobs.Num(); i++)
+    {
+        const FQueuedJob& Job = Jobs[i];
+        if (Job.StartTime > Now) continue;
+        if (Job.Priority != ASP_User && Playing) continue;
+
+        if (Next == INDEX_NONE || Job.Priority < Jobs[Next].Priority) Next = i;
+    }
+
+    if (Next == INDEX_NONE) return true;
+    if (Jobs[Next].Priority == ASP_Background && !IsEditorIdle()) return true;
+
+    // Removed before it runs, the job may queue follow up work
+    FQueuedJob Job = MoveTemp(Jobs[Next]);
+    Jobs.RemoveAt(Next);
+
+    UE_LOG(AssetManagementLog, Verbose, TEXT("Running scan job %s with priority %d, %d job(s) left"), *Job.Key.ToString(), static_cast<int32>(Job.Priority), Jobs.Num());
+    Job.Job();
+
+    return true;
+}
+
+bool AssetScanScheduler::IsEditorIdle() const
+{
+    // Long frames mean the editor is busy with something else, like compiling or importing
+    const float MaxFrameTime = AssetManagerConfig::Get().GetInt("Scan", "IdleFrameTimeMs", 50) / 1000.0f;
+    if (AverageFrameTime > MaxFrameTime) return false;
+
+    if (!FSlateApplication::IsInitialized()) return true;
+
+    const double IdleTime = AssetManagerConfig::Get().GetInt("Scan", "IdleInputSeconds", 5);
+    return FSlateApplication::Get().GetCurrentTime() - FSlateApplication::Get().GetLastUserInteractionTime() >= IdleTime;
+}
+
+bool AssetScanScheduler::IsPlayingInEditor()
+{
+    return GEditor != nullptr && GEditor->GetPIEWorldContext() != nullptr;
+}
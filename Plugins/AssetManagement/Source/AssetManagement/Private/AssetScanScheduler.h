@@ -0,0 +1,48 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+
+enum EAssetScanPriority
+{
+    ASP_User,        // Requested from the UI, runs on the next tick
+    ASP_Incremental, // Registry and configuration changes
+    ASP_Background,  // Full validation, only runs while the editor is idle
+};
+
+// Runs scan jobs on the game thread one per tick, highest priority first, and holds back everything but user requests during Play In Editor
+class AssetScanScheduler
+{
+public:
+    typedef TFunction<void()> FJob;
+
+    void Start();
+    void Stop();
+
+    // A job replaces a queued job with the same key and inherits the higher priority and the earlier start time, NAME_None never replaces anything
+    void Enqueue(EAssetScanPriority Priority, FName Key, FJob Job, float Delay = 0.0f);
+
+    int32 Num() const { return Jobs.Num(); }
+
+private:
+    struct FQueuedJob
+    {
+        EAssetScanPriority Priority;
+        FName Key;
+        FJob Job;
+        double StartTime;
+    };
+
+    bool Tick(float DeltaTime);
+    bool IsEditorIdle() const;
+    static bool IsPlayingInEditor();
+
+#if ENGINE_MAJOR_VERSION >= 5
+    FTSTicker::FDelegateHandle TickHandle;
+#else
+    FDelegateHandle TickHandle;
+#endif
+
+    // Kept in queue order, so jobs of the same priority run first in first out
+    TArray<FQueuedJob> Jobs;
+    float AverageFrameTime = 0.0f;
+};
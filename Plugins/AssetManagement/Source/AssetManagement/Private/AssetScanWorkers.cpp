@@ -0,0 +1,145 @@
+#include "AssetScanWorkers.h"
+#include "AssetMagementConfig.h"
+#include "AssetManagementModule.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "ShaderCompiler.h"
+
+#define WORKER_STACK_SIZE (128 * 1024)
+
+FThreadSafeBool AssetScanWorkers::Throttled;
+
+namespace
+{
+    struct FParallelState
+    {
+        TFunctionRef<void(int32)> Body;
+        int32 Num;
+        FThreadSafeCounter NextIndex;
+        FThreadSafeCounter Running;
+
+        FParallelState(TFunctionRef<void(int32)> InBody, int32 InNum) : Body(InBody), Num(InNum) { }
+
+        void Run(bool bWorker)
+        {
+            for (int32 Index = NextIndex.Increment() - 1; Index < Num; Index = NextIndex.Increment() - 1)
+            {
+                Body(Index);
+                AssetScanWorkers::YieldPoint();
+
+                // Workers hand the remaining indices to the calling thread while the editor is busy
+                if (bWorker && AssetScanWorkers::IsThrottled()) return;
+            }
+        }
+    };
+
+    class FParallelWork : public IQueuedWork
+    {
+    public:
+        explicit FParallelWork(FParallelState& InState) : State(InState) { }
+
+        // The state may be gone as soon as the counter drops, it is the last access
+        void DoThreadedWork() override
+        {
+            State.Run(true);
+            State.Running.Decrement();
+        }
+
+        void Abandon() override
+        {
+            State.Running.Decrement();
+        }
+
+    private:
+        FParallelState& State;
+    };
+}
+
+AssetScanWorkers& AssetScanWorkers::Get()
+{
+    static AssetScanWorkers instance;
+    return instance;
+}
+
+void AssetScanWorkers::ParallelFor(int32 Num, TFunctionRef<void(int32)> Body)
+{
+    if (Num <= 0) return;
+
+    Configure();
+    UpdateThrottle();
+
+    // While the editor is busy only the calling thread keeps going
+    const int32 NumWorkers = Throttled ? 0 : FMath::Min(NumActive - 1, Num - 1);
+
+    FParallelState State(Body, Num);
+    TArray<FParallelWork> Work;
+    if (Pool != nullptr && NumWorkers > 0)
+    {
+        Work.Reserve(NumWorkers);
+        State.Running.Set(NumWorkers);
+        for (int32 i = 0; i < NumWorkers; i++)
+        {
+            Pool->AddQueuedWork(&Work[Work.Emplace(State)]);
+        }
+    }
+
+    State.Run(false);
+
+    // Only indices already picked up by a worker are left
+    while (State.Running.GetValue() > 0)
+    {
+        FPlatformProcess::Sleep(0.0f);
+    }
+}
+
+void AssetScanWorkers::YieldPoint()
+{
+    // Sleeping here would stall the editor, the game thread only notices the editor got busy
+    if (IsInGameThread()) UpdateThrottle();
+}
+
+void AssetScanWorkers::Shutdown()
+{
+    if (Pool != nullptr)
+    {
+        Pool->Destroy();
+        delete Pool;
+        Pool = nullptr;
+    }
+
+    NumThreads = 0;
+}
+
+void AssetScanWorkers::Configure()
+{
+    const int32 NumCores = FPlatformMisc::NumberOfCoresIncludingHyperthreads();
+
+    // 0 leaves one core for the game thread
+    int32 Threads = AssetManagerConfig::Get().GetInt("Scan", "WorkerThreads", 0);
+    if (Threads <= 0) Threads = NumCores - 1;
+    Threads = FMath::Max(Threads, 0);
+
+    const int32 CpuShare = FMath::Clamp(AssetManagerConfig::Get().GetInt("Scan", "CpuSharePercent", 75), 1, 100);
+    NumActive = FMath::Clamp(FMath::DivideAndRoundUp(NumCores * CpuShare, 100), 1, Threads + 1);
+
+    if (Threads == NumThreads) return;
+
+    Shutdown();
+    if (Threads == 0) return;
+
+    Pool = FQueuedThreadPool::Allocate();
+    if (!Pool->Create(Threads, WORKER_STACK_SIZE, TPri_BelowNormal))
+    {
+        UE_LOG(AssetManagementLog, Warning, TEXT("Could not create %d scan worker thread(s), scanning on the calling thread"), Threads);
+        delete Pool;
+        Pool = nullptr;
+        return;
+    }
+
+    NumThreads = Threads;
+}
+
+void AssetScanWorkers::UpdateThrottle()
+{
+    Throttled = GShaderCompilingManager != nullptr && GShaderCompilingManager->IsCompiling();
+}
@@ -0,0 +1,33 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "Misc/QueuedThreadPool.h"
+#include "HAL/ThreadSafeBool.h"
+
+// Dedicated low priority thread pool for scan work, so scans never compete with the engine task graph
+// The number of threads working on a loop follows the configured CPU share and drops while the editor compiles shaders
+class AssetScanWorkers
+{
+public:
+    static AssetScanWorkers& Get();
+
+    // Runs Body for every index on the pool and the calling thread, returns once every index is done
+    void ParallelFor(int32 Num, TFunctionRef<void(int32)> Body);
+
+    // Called from long loops on any thread, refreshes the throttle state on the game thread and never sleeps
+    static void YieldPoint();
+    static bool IsThrottled() { return Throttled; }
+
+    void Shutdown();
+
+private:
+    // Reads the thread count and CPU share from the settings, the pool is only recreated when the thread count changed
+    void Configure();
+    static void UpdateThrottle();
+
+    FQueuedThreadPool* Pool = nullptr;
+    int32 NumThreads = 0;
+    // Threads working on a loop, including the calling thread
+    int32 NumActive = 1;
+
+    static FThreadSafeBool Throttled;
+};
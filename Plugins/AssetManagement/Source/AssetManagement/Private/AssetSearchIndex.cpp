@@ -0,0 +1,354 @@
+#include "AssetSearchIndex.h"
+
+#define MIN_CAPACITY 1024
+
+FAssetQuery FAssetQuery::Parse(const FString& Text, const TArray<int32>& Actions)
+{
+    FAssetQuery Query;
+    Query.Actions = Actions;
+
+    TArray<FString> Tokens;
+    Text.ParseIntoArrayWS(Tokens);
+
+    for (FString& Token : Tokens)
+    {
+        if (Token.StartsWith(TEXT("class:"), ESearchCase::IgnoreCase))
+        {
+            if (Token.Len() > 6) Query.Classes.Add(Token.Mid(6));
+        }
+        else if (Token.StartsWith(TEXT("path:"), ESearchCase::IgnoreCase))
+        {
+            if (Token.Len() > 5) Query.Paths.Add(Token.Mid(5));
+        }
+        else
+        {
+            Query.Words.Add(Token.ToLower());
+        }
+    }
+
+    return Query;
+}
+
+void AssetSearchIndex::Reset(const TSparseArray<FAssetInfo>& Assets)
+{
+    Capacity = 0;
+    Names.Empty();
+    Trigrams.Empty();
+    ActionBits.Empty();
+    ClassBits.Empty();
+
+    PathNodes.Empty();
+    PathNodes.AddDefaulted();
+
+    // Slots are visited in ascending order, so every posting list comes out sorted
+    for (TSparseArray<FAssetInfo>::TConstIterator It(Assets); It; ++It)
+    {
+        Add(It.GetIndex(), *It);
+    }
+}
+
+void AssetSearchIndex::Add(int32 Slot, const FAssetInfo& Asset)
+{
+    Grow(Slot);
+
+    FString& Name = Names[Slot];
+    Name = Asset.Data.AssetName.ToString().ToLower();
+
+    TArray<uint64> NameTrigrams;
+    GetTrigrams(Name, NameTrigrams);
+    for (uint64 Trigram : NameTrigrams)
+    {
+        TArray<int32>& Slots = Trigrams.FindOrAdd(Trigram);
+        if (Slots.Num() == 0 || Slots.Last() < Slot) Slots.Add(Slot);
+        else Slots.Insert(Slot, LowerBound(Slots, Slot));
+    }
+
+    PathNodes[FindPathNode(Asset.Data.PackagePath, true)].Slots.Add(Slot);
+
+    for (auto& Result : Asset.ActionResults)
+    {
+        while (ActionBits.Num() <= Result.Key) ActionBits.AddDefaulted();
+        SetBit(GetBits(ActionBits[Result.Key]), Slot, true);
+    }
+
+    SetBit(GetBits(ClassBits.FindOrAdd(Asset.Data.AssetClass)), Slot, true);
+}
+
+void AssetSearchIndex::Remove(int32 Slot, const FAssetInfo& Asset)
+{
+    if (Slot >= Capacity) return;
+
+    TArray<uint64> NameTrigrams;
+    GetTrigrams(Names[Slot], NameTrigrams);
+    for (uint64 Trigram : NameTrigrams)
+    {
+        TArray<int32>* Slots = Trigrams.Find(Trigram);
+        if (Slots == nullptr) continue;
+
+        const int32 Position = LowerBound(*Slots, Slot);
+        if (Slots->IsValidIndex(Position) && (*Slots)[Position] == Slot) Slots->RemoveAt(Position, 1, false);
+        if (Slots->Num() == 0) Trigrams.Remove(Trigram);
+    }
+
+    Names[Slot].Empty();
+
+    const int32 Node = FindPathNode(Asset.Data.PackagePath, false);
+    if (Node != INDEX_NONE) PathNodes[Node].Slots.RemoveSwap(Slot);
+
+    for (TBitArray<>& Bits : ActionBits)
+    {
+        SetBit(Bits, Slot, false);
+    }
+
+    TBitArray<>* Bits = ClassBits.Find(Asset.Data.AssetClass);
+    if (Bits != nullptr) SetBit(*Bits, Slot, false);
+}
+
+TBitArray<> AssetSearchIndex::Query(const FAssetQuery& Query)
+{
+    TBitArray<> Result(false, Capacity);
+
+    for (int32 Action : Query.Actions)
+    {
+        if (ActionBits.IsValidIndex(Action)) Or(Result, GetBits(ActionBits[Action]));
+    }
+
+    if (Query.Classes.Num() > 0)
+    {
+        TBitArray<> ClassResult(false, Capacity);
+        for (auto& Class : ClassBits)
+        {
+            const FString ClassName = Class.Key.ToString();
+            for (const FString& Prefix : Query.Classes)
+            {
+                if (!ClassName.StartsWith(Prefix, ESearchCase::IgnoreCase)) continue;
+
+                Or(ClassResult, GetBits(Class.Value));
+                break;
+            }
+        }
+
+        And(Result, ClassResult);
+    }
+
+    if (Query.Paths.Num() > 0)
+    {
+        TBitArray<> PathResult(false, Capacity);
+        for (const FString& Prefix : Query.Paths)
+        {
+            CollectPath(Prefix, PathResult);
+        }
+
+        And(Result, PathResult);
+    }
+
+    for (const FString& Word : Query.Words)
+    {
+        FilterWord(Word, Result);
+    }
+
+    return Result;
+}
+
+void AssetSearchIndex::GetTrigrams(const FString& Name, TArray<uint64>& OutTrigrams)
+{
+    for (int32 i = 0; i + 3 <= Name.Len(); i++)
+    {
+        const uint64 Trigram = (static_cast<uint64>(Name[i] & 0xFFFF) << 32) | (static_cast<uint64>(Name[i + 1] & 0xFFFF) << 16) | static_cast<uint64>(Name[i + 2] & 0xFFFF);
+        OutTrigrams.AddUnique(Trigram);
+    }
+}
+
+int32 AssetSearchIndex::LowerBound(const TArray<int32>& Slots, int32 Slot)
+{
+    int32 Start = 0;
+    int32 Count = Slots.Num();
+    while (Count > 0)
+    {
+        const int32 Step = Count / 2;
+        if (Slots[Start + Step] < Slot)
+        {
+            Start += Step + 1;
+            Count -= Step + 1;
+        }
+        else
+        {
+            Count = Step;
+        }
+    }
+
+    return Start;
+}
+
+int32 AssetSearchIndex::FindPathNode(FName PackagePath, bool Create)
+{
+    if (PathNodes.Num() == 0) PathNodes.AddDefaulted();
+
+    TArray<FString> Segments;
+    PackagePath.ToString().ParseIntoArray(Segments, TEXT("/"), true);
+
+    int32 Node = 0;
+    for (const FString& Segment : Segments)
+    {
+        const FName SegmentName(*Segment);
+        const int32* Child = PathNodes[Node].Children.Find(SegmentName);
+        if (Child != nullptr)
+        {
+            Node = *Child;
+            continue;
+        }
+
+        if (!Create) return INDEX_NONE;
+
+        const int32 NewNode = PathNodes.AddDefaulted();
+        PathNodes[Node].Children.Add(SegmentName, NewNode);
+        Node = NewNode;
+    }
+
+    return Node;
+}
+
+void AssetSearchIndex::CollectPath(const FString& Prefix, TBitArray<>& OutSlots) const
+{
+    if (PathNodes.Num() == 0) return;
+
+    TArray<FString> Segments;
+    Prefix.ParseIntoArray(Segments, TEXT("/"), true);
+
+    // Without a trailing slash the last segment only has to start a folder name
+    const bool PartialLast = Segments.Num() > 0 && !Prefix.EndsWith(TEXT("/"));
+    const int32 NumExact = PartialLast ? Segments.Num() - 1 : Segments.Num();
+
+    int32 Node = 0;
+    for (int32 i = 0; i < NumExact; i++)
+    {
+        const FName SegmentName(*Segments[i], FNAME_Find);
+        const int32* Child = SegmentName.IsNone() ? nullptr : PathNodes[Node].Children.Find(SegmentName);
+        if (Child == nullptr) return;
+
+        Node = *Child;
+    }
+
+    TArray<int32> Stack;
+    if (PartialLast)
+    {
+        for (auto& Child : PathNodes[Node].Children)
+        {
+            if (Child.Key.ToString().StartsWith(Segments.Last(), ESearchCase::IgnoreCase)) Stack.Add(Child.Value);
+        }
+    }
+    else
+    {
+        Stack.Add(Node);
+    }
+
+    while (Stack.Num() > 0)
+    {
+        const FPathNode& Current = PathNodes[Stack.Pop(false)];
+        for (int32 Slot : Current.Slots)
+        {
+            OutSlots[Slot] = true;
+        }
+
+        for (auto& Child : Current.Children)
+        {
+            Stack.Add(Child.Value);
+        }
+    }
+}
+
+void AssetSearchIndex::FilterWord(const FString& Word, TBitArray<>& Candidates) const
+{
+    TArray<uint64> WordTrigrams;
+    GetTrigrams(Word, WordTrigrams);
+
+    TBitArray<> Matches(false, Capacity);
+
+    if (WordTrigrams.Num() == 0)
+    {
+        // Too short for the trigram index, check the remaining candidates directly
+        for (TConstSetBitIterator<> It(Candidates); It; ++It)
+        {
+            if (Names[It.GetIndex()].Contains(Word, ESearchCase::CaseSensitive)) Matches[It.GetIndex()] = true;
+        }
+
+        Candidates = Matches;
+        return;
+    }
+
+    // Only the rarest trigram is walked, the substring check covers the others
+    const TArray<int32>* Shortest = nullptr;
+    for (uint64 Trigram : WordTrigrams)
+    {
+        const TArray<int32>* Slots = Trigrams.Find(Trigram);
+        if (Slots == nullptr)
+        {
+            Candidates = Matches;
+            return;
+        }
+
+        if (Shortest == nullptr || Slots->Num() < Shortest->Num()) Shortest = Slots;
+    }
+
+    for (int32 Slot : *Shortest)
+    {
+        if (Candidates[Slot] && Names[Slot].Contains(Word, ESearchCase::CaseSensitive)) Matches[Slot] = true;
+    }
+
+    Candidates = Matches;
+}
+
+void AssetSearchIndex::Grow(int32 Slot)
+{
+    if (Slot < Capacity) return;
+
+    // Capacity stays a multiple of 32 so bit sets can be combined a word at a time
+    Capacity = Align(FMath::Max3(Slot + 1, Capacity * 2, MIN_CAPACITY), 32);
+    Names.SetNum(Capacity);
+
+    for (TBitArray<>& Bits : ActionBits)
+    {
+        GetBits(Bits);
+    }
+
+    for (auto& Bits : ClassBits)
+    {
+        GetBits(Bits.Value);
+    }
+}
+
+TBitArray<>& AssetSearchIndex::GetBits(TBitArray<>& Bits)
+{
+    while (Bits.Num() < Capacity) Bits.Add(false);
+    return Bits;
+}
+
+void AssetSearchIndex::SetBit(TBitArray<>& Bits, int32 Slot, bool Value)
+{
+    if (Slot < Bits.Num()) Bits[Slot] = Value;
+}
+
+void AssetSearchIndex::And(TBitArray<>& Target, const TBitArray<>& Other)
+{
+    uint32* TargetWords = Target.GetData();
+    const uint32* OtherWords = Other.GetData();
+
+    const int32 NumWords = Target.Num() / 32;
+    const int32 NumOtherWords = Other.Num() / 32;
+    for (int32 i = 0; i < NumWords; i++)
+    {
+        TargetWords[i] = i < NumOtherWords ? TargetWords[i] & OtherWords[i] : 0;
+    }
+}
+
+void AssetSearchIndex::Or(TBitArray<>& Target, const TBitArray<>& Other)
+{
+    uint32* TargetWords = Target.GetData();
+    const uint32* OtherWords = Other.GetData();
+
+    const int32 NumWords = FMath::Min(Target.Num(), Other.Num()) / 32;
+    for (int32 i = 0; i < NumWords; i++)
+    {
+        TargetWords[i] |= OtherWords[i];
+    }
+}
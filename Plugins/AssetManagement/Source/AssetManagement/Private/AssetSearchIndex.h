@@ -0,0 +1,58 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "AssetAction.h"
+
+// Parsed search box text, "class:" and "path:" tokens match by prefix, every other word has to appear in the asset name
+struct FAssetQuery
+{
+    TArray<FString> Words;
+    TArray<FString> Classes;
+    TArray<FString> Paths;
+    TArray<int32> Actions;
+
+    static FAssetQuery Parse(const FString& Text, const TArray<int32>& Actions);
+};
+
+// Filter structures kept next to the asset slots, so a query never has to visit every asset
+class AssetSearchIndex
+{
+public:
+    void Reset(const TSparseArray<FAssetInfo>& Assets);
+
+    // The asset must be passed unchanged to Remove, the entries to drop are derived from it
+    void Add(int32 Slot, const FAssetInfo& Asset);
+    void Remove(int32 Slot, const FAssetInfo& Asset);
+
+    // Returns one bit per slot, set for every asset matching the query
+    TBitArray<> Query(const FAssetQuery& Query);
+
+private:
+    struct FPathNode
+    {
+        TMap<FName, int32> Children;
+        TArray<int32> Slots;
+    };
+
+    static void GetTrigrams(const FString& Name, TArray<uint64>& OutTrigrams);
+    static int32 LowerBound(const TArray<int32>& Slots, int32 Slot);
+
+    int32 FindPathNode(FName PackagePath, bool Create);
+    void CollectPath(const FString& Prefix, TBitArray<>& OutSlots) const;
+    void FilterWord(const FString& Word, TBitArray<>& Candidates) const;
+
+    void Grow(int32 Slot);
+    TBitArray<>& GetBits(TBitArray<>& Bits);
+    static void SetBit(TBitArray<>& Bits, int32 Slot, bool Value);
+    static void And(TBitArray<>& Target, const TBitArray<>& Other);
+    static void Or(TBitArray<>& Target, const TBitArray<>& Other);
+
+    int32 Capacity = 0;
+
+    // Lower case asset names, used to verify trigram candidates
+    TArray<FString> Names;
+    TMap<uint64, TArray<int32>> Trigrams;
+
+    TArray<FPathNode> PathNodes;
+    TArray<TBitArray<>> ActionBits;
+    TMap<FName, TBitArray<>> ClassBits;
+};
@@ -0,0 +1,103 @@
+#include "AssetSnapshotDiff.h"
+#include "AssetIndexFile.h"
+
+bool AssetSnapshotDiff::LoadSnapshot(const FString& Path, TArray<FString>& OutActionNames, TArray<FAssetInfo>& OutAssets)
+{
+    AssetIndexFile Index;
+    if (!Index.Open(Path)) return false;
+
+    Index.ReadActionNames(OutActionNames);
+    Index.ReadAssets(OutActionNames, OutAssets);
+    return true;
+}
+
+void AssetSnapshotDiff::Diff(const TArray<FString>& OldActionNames, TArray<FAssetInfo>& OldAssets, const TArray<FString>& NewActionNames, TArray<FAssetInfo>& NewAssets, TArray<FAssetActionDiff>& OutDiffs)
+{
+    EnsurePackageOrder(OldAssets);
+    EnsurePackageOrder(NewAssets);
+
+    // Only actions present in the new snapshot are reported, old ids are mapped to them by name
+    OutDiffs.Reset();
+    OutDiffs.SetNum(NewActionNames.Num());
+    for (int32 i = 0; i < NewActionNames.Num(); i++)
+    {
+        OutDiffs[i].ActionName = NewActionNames[i];
+    }
+
+    TArray<int32> OldToNew;
+    for (const FString& Name : OldActionNames)
+    {
+        OldToNew.Add(NewActionNames.IndexOfByKey(Name));
+    }
+
+    auto AddAll = [&OutDiffs](const FAssetInfo& Asset, bool Added)
+    {
+        for (auto& Result : Asset.ActionResults)
+        {
+            if (!OutDiffs.IsValidIndex(Result.Key)) continue;
+
+            if (Added) OutDiffs[Result.Key].Added.Add(Asset.Data.PackageName);
+            else OutDiffs[Result.Key].Resolved.Add(Asset.Data.PackageName);
+        }
+    };
+
+    // Old results are remapped to the ids of the new snapshot up front, so both sides compare the same keys
+    auto Remap = [&OldToNew](const FAssetInfo& Asset)
+    {
+        FAssetInfo Mapped;
+        Mapped.Data = Asset.Data;
+        for (auto& Result : Asset.ActionResults)
+        {
+            if (OldToNew.IsValidIndex(Result.Key) && OldToNew[Result.Key] != INDEX_NONE) Mapped.ActionResults.Add(OldToNew[Result.Key], Result.Value);
+        }
+        return Mapped;
+    };
+
+    int32 i = 0;
+    int32 j = 0;
+    while (i < OldAssets.Num() || j < NewAssets.Num())
+    {
+        int32 Order;
+        if (i == OldAssets.Num()) Order = 1;
+        else if (j == NewAssets.Num()) Order = -1;
+        else Order = OldAssets[i].Data.PackageName.Compare(NewAssets[j].Data.PackageName);
+
+        if (Order < 0)
+        {
+            AddAll(Remap(OldAssets[i++]), false);
+        }
+        else if (Order > 0)
+        {
+            AddAll(NewAssets[j++], true);
+        }
+        else
+        {
+            const FAssetInfo Old = Remap(OldAssets[i++]);
+            const FAssetInfo& New = NewAssets[j++];
+
+            for (auto& Result : New.ActionResults)
+            {
+                if (OutDiffs.IsValidIndex(Result.Key) && !Old.ActionResults.Contains(Result.Key)) OutDiffs[Result.Key].Added.Add(New.Data.PackageName);
+            }
+
+            for (auto& Result : Old.ActionResults)
+            {
+                if (OutDiffs.IsValidIndex(Result.Key) && !New.ActionResults.Contains(Result.Key)) OutDiffs[Result.Key].Resolved.Add(New.Data.PackageName);
+            }
+        }
+    }
+}
+
+void AssetSnapshotDiff::EnsurePackageOrder(TArray<FAssetInfo>& Assets)
+{
+    auto Less = [](const FAssetInfo& A, const FAssetInfo& B) { return A.Data.PackageName.Compare(B.Data.PackageName) < 0; };
+
+    // Snapshots written by older versions are in list order
+    for (int32 i = 1; i < Assets.Num(); i++)
+    {
+        if (!Less(Assets[i], Assets[i - 1])) continue;
+
+        Assets.Sort(Less);
+        return;
+    }
+}
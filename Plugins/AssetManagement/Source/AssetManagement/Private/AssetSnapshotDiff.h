@@ -0,0 +1,25 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "AssetAction.h"
+
+// Results that appeared or disappeared for one action between two snapshots
+struct FAssetActionDiff
+{
+    FString ActionName;
+    TArray<FName> Added;
+    TArray<FName> Resolved;
+};
+
+// Compares two scan snapshots by merging their package name ordered asset lists
+class AssetSnapshotDiff
+{
+public:
+    // Reads an asset index file, results are matched by action name so snapshots of different plugin versions can be compared
+    static bool LoadSnapshot(const FString& Path, TArray<FString>& OutActionNames, TArray<FAssetInfo>& OutAssets);
+
+    // Both lists are expected in package name order, lists in any other order are sorted first
+    static void Diff(const TArray<FString>& OldActionNames, TArray<FAssetInfo>& OldAssets, const TArray<FString>& NewActionNames, TArray<FAssetInfo>& NewAssets, TArray<FAssetActionDiff>& OutDiffs);
+
+private:
+    static void EnsurePackageOrder(TArray<FAssetInfo>& Assets);
+};
@@ -0,0 +1,73 @@
+#include "AssetSnapshotDiffCommandlet.h"
+#include "AssetSnapshotDiff.h"
+#include "AssetIndexFile.h"
+#include "AssetManagementModule.h"
+#include "Misc/FileHelper.h"
+
+UAssetSnapshotDiffCommandlet::UAssetSnapshotDiffCommandlet()
+{
+    IsClient = false;
+    IsServer = false;
+    IsEditor = true;
+    LogToConsole = true;
+}
+
+int32 UAssetSnapshotDiffCommandlet::Main(const FString& Params)
+{
+    FString OldPath;
+    FString NewPath = AssetIndexFile::GetDefaultPath();
+    FString ActionFilter;
+    FString OutputPath;
+
+    if (!FParse::Value(*Params, TEXT("Old="), OldPath))
+    {
+        UE_LOG(AssetManagementLog, Error, TEXT("Missing -Old=<snapshot>"));
+        return 2;
+    }
+
+    FParse::Value(*Params, TEXT("New="), NewPath);
+    FParse::Value(*Params, TEXT("Actions="), ActionFilter);
+    FParse::Value(*Params, TEXT("Output="), OutputPath);
+
+    TArray<FString> OldActions;
+    TArray<FString> NewActions;
+    TArray<FAssetInfo> OldAssets;
+    TArray<FAssetInfo> NewAssets;
+
+    if (!AssetSnapshotDiff::LoadSnapshot(OldPath, OldActions, OldAssets) || !AssetSnapshotDiff::LoadSnapshot(NewPath, NewActions, NewAssets))
+    {
+        UE_LOG(AssetManagementLog, Error, TEXT("Failed to read snapshot %s or %s"), *OldPath, *NewPath);
+        return 2;
+    }
+
+    TArray<FAssetActionDiff> Diffs;
+    AssetSnapshotDiff::Diff(OldActions, OldAssets, NewActions, NewAssets, Diffs);
+
+    TArray<FString> SelectedActions;
+    ActionFilter.ParseIntoArray(SelectedActions, TEXT(","), true);
+
+    FString Report;
+    int32 Regressions = 0;
+    for (FAssetActionDiff& Diff : Diffs)
+    {
+        if (SelectedActions.Num() > 0 && !SelectedActions.Contains(Diff.ActionName)) continue;
+
+        Report += FString::Printf(TEXT("%s: %d new, %d resolved\n"), *Diff.ActionName, Diff.Added.Num(), Diff.Resolved.Num());
+        for (FName& PackageName : Diff.Added)
+        {
+            Report += "  + " + PackageName.ToString() + "\n";
+        }
+
+        Regressions += Diff.Added.Num();
+    }
+
+    UE_LOG(AssetManagementLog, Display, TEXT("%s"), *Report);
+
+    if (!OutputPath.IsEmpty() && !FFileHelper::SaveStringToFile(Report, *OutputPath))
+    {
+        UE_LOG(AssetManagementLog, Error, TEXT("Failed to write %s"), *OutputPath);
+        return 2;
+    }
+
+    return Regressions > 0 ? 1 : 0;
+}
@@ -0,0 +1,18 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "AssetSnapshotDiffCommandlet.generated.h"
+
+// Reports results introduced between two snapshots, for use as a review gate
+// Usage: -run=AssetSnapshotDiff -Old=<index> [-New=<index>] [-Actions="Unused assets,Redirectors"] [-Output=<file>]
+// Returns 1 if any of the selected actions has new results
+UCLASS()
+class UAssetSnapshotDiffCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UAssetSnapshotDiffCommandlet();
+
+    int32 Main(const FString& Params) override;
+};
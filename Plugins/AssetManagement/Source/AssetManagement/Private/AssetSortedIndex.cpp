@@ -0,0 +1,194 @@
+#include "AssetSortedIndex.h"
+
+#define PREFIX_LENGTH 8
+#define MIN_PENDING_MERGE 64
+
+void AssetSortedIndex::Reset(const TSparseArray<FAssetInfo>& Assets)
+{
+    Run.Reset(Assets.Num());
+    Pending.Reset();
+
+    for (TSparseArray<FAssetInfo>::TConstIterator It(Assets); It; ++It)
+    {
+        Run.Add(MakeKey(It.GetIndex(), *It));
+    }
+
+    Run.Sort([](const FSortKey& A, const FSortKey& B) { return Less(A, B); });
+}
+
+void AssetSortedIndex::Add(int32 Slot, const FAssetInfo& Asset)
+{
+    Pending.Add(MakeKey(Slot, Asset));
+
+    // Merging at sqrt(n) pending keys keeps both the amortized merge cost and the linear pending search in Remove small
+    if (Pending.Num() > FMath::Max(MIN_PENDING_MERGE, FMath::FloorToInt(FMath::Sqrt(static_cast<float>(Run.Num())))))
+    {
+        Merge();
+    }
+}
+
+void AssetSortedIndex::Remove(int32 Slot, const FAssetInfo& Asset)
+{
+    for (int32 i = 0; i < Pending.Num(); i++)
+    {
+        if (Pending[i].Slot == Slot)
+        {
+            Pending.RemoveAtSwap(i);
+            return;
+        }
+    }
+
+    const FSortKey Key = MakeKey(Slot, Asset);
+
+    // First key in the run that does not sort before the removed one
+    int32 Start = 0;
+    int32 Count = Run.Num();
+    while (Count > 0)
+    {
+        const int32 Step = Count / 2;
+        if (Less(Run[Start + Step], Key))
+        {
+            Start += Step + 1;
+            Count -= Step + 1;
+        }
+        else
+        {
+            Count = Step;
+        }
+    }
+
+    if (Run.IsValidIndex(Start) && Run[Start].Slot == Slot)
+    {
+        Run.RemoveAt(Start);
+    }
+}
+
+void AssetSortedIndex::GetSlots(TArray<int32>& OutSlots)
+{
+    Merge();
+
+    OutSlots.Reset(Run.Num());
+    for (const FSortKey& Key : Run)
+    {
+        OutSlots.Add(Key.Slot);
+    }
+}
+
+FString AssetSortedIndex::GetOrderName(EAssetSortOrder Order)
+{
+    switch (Order)
+    {
+    case EAssetSortOrder::Path: return "Path";
+    case EAssetSortOrder::Name: return "Name";
+    case EAssetSortOrder::Class: return "Class";
+    case EAssetSortOrder::Size: return "Size";
+    case EAssetSortOrder::ActionCount: return "Issues";
+    default: return "";
+    }
+}
+
+AssetSortedIndex::FSortKey AssetSortedIndex::MakeKey(int32 Slot, const FAssetInfo& Asset) const
+{
+    FSortKey Key;
+    Key.Numeric = 0;
+    Key.Text = Asset.Data.PackageName;
+    Key.Package = Asset.Data.PackageName;
+    Key.Slot = Slot;
+
+    switch (Order)
+    {
+    case EAssetSortOrder::Name:
+        Key.Text = Asset.Data.AssetName;
+        break;
+    case EAssetSortOrder::Class:
+        Key.Text = Asset.Data.AssetClass;
+        break;
+    // Largest and most flagged assets come first
+    case EAssetSortOrder::Size:
+        Key.Numeric = -Asset.PackageSize;
+        break;
+    case EAssetSortOrder::ActionCount:
+        Key.Numeric = -Asset.ActionResults.Num();
+        break;
+    default:
+        break;
+    }
+
+    Key.Prefix = MakePrefix(Key.Text, Key.Text == Key.Package);
+    return Key;
+}
+
+uint64 AssetSortedIndex::MakePrefix(FName Text, bool SkipRoot)
+{
+    // FName::Compare orders by the plain string first, so the prefix has to be taken from it as well
+    const FString Plain = Text.GetPlainNameString();
+
+    int32 Start = 0;
+    if (SkipRoot)
+    {
+        // Every indexed package lives in /Game/, those characters would never tell two keys apart
+        if (!Plain.StartsWith(TEXT("/Game/"), ESearchCase::IgnoreCase)) return 0;
+        Start = 6;
+    }
+
+    // Case folded ASCII packed big endian, packing stops at the first other character so prefixes never contradict Compare
+    uint64 Prefix = 0;
+    bool Stopped = false;
+    for (int32 i = 0; i < PREFIX_LENGTH; i++)
+    {
+        uint8 Byte = 0;
+        if (!Stopped && Start + i < Plain.Len())
+        {
+            const TCHAR Char = Plain[Start + i];
+            if (Char < 0x80)
+            {
+                Byte = static_cast<uint8>(FChar::ToLower(Char));
+            }
+            else
+            {
+                Byte = 0x80;
+                Stopped = true;
+            }
+        }
+
+        Prefix = (Prefix << 8) | Byte;
+    }
+
+    return Prefix;
+}
+
+bool AssetSortedIndex::Less(const FSortKey& A, const FSortKey& B)
+{
+    if (A.Numeric != B.Numeric) return A.Numeric < B.Numeric;
+
+    // A zero prefix means it could not be computed, only then or on a tie the names are compared
+    if (A.Prefix != B.Prefix && A.Prefix != 0 && B.Prefix != 0) return A.Prefix < B.Prefix;
+    if (A.Text != B.Text) return A.Text.Compare(B.Text) < 0;
+    if (A.Package != B.Package) return A.Package.Compare(B.Package) < 0;
+
+    return A.Slot < B.Slot;
+}
+
+void AssetSortedIndex::Merge()
+{
+    if (Pending.Num() == 0) return;
+
+    Pending.Sort([](const FSortKey& A, const FSortKey& B) { return Less(A, B); });
+
+    TArray<FSortKey> Merged;
+    Merged.Reserve(Run.Num() + Pending.Num());
+
+    int32 RunIndex = 0;
+    int32 PendingIndex = 0;
+    while (RunIndex < Run.Num() && PendingIndex < Pending.Num())
+    {
+        if (Less(Pending[PendingIndex], Run[RunIndex])) Merged.Add(Pending[PendingIndex++]);
+        else Merged.Add(Run[RunIndex++]);
+    }
+
+    for (; RunIndex < Run.Num(); RunIndex++) Merged.Add(Run[RunIndex]);
+    for (; PendingIndex < Pending.Num(); PendingIndex++) Merged.Add(Pending[PendingIndex]);
+
+    Run = MoveTemp(Merged);
+    Pending.Reset();
+}
@@ -0,0 +1,54 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "AssetAction.h"
+
+enum class EAssetSortOrder : uint8
+{
+    Path,
+    Name,
+    Class,
+    Size,
+    ActionCount,
+
+    Count
+};
+
+// Asset slots ordered by a precomputed key, inserts are buffered and merged into the sorted run in batches
+class AssetSortedIndex
+{
+public:
+    void SetOrder(EAssetSortOrder InOrder) { Order = InOrder; }
+    EAssetSortOrder GetOrder() const { return Order; }
+
+    // Rebuilds the whole index, used after a full scan or when the order changes
+    void Reset(const TSparseArray<FAssetInfo>& Assets);
+
+    // The asset must be passed unchanged to Remove, its key is derived from it
+    void Add(int32 Slot, const FAssetInfo& Asset);
+    void Remove(int32 Slot, const FAssetInfo& Asset);
+
+    void GetSlots(TArray<int32>& OutSlots);
+
+    static FString GetOrderName(EAssetSortOrder Order);
+
+private:
+    struct FSortKey
+    {
+        int64 Numeric;
+        uint64 Prefix;
+        FName Text;
+        FName Package;
+        int32 Slot;
+    };
+
+    FSortKey MakeKey(int32 Slot, const FAssetInfo& Asset) const;
+    static uint64 MakePrefix(FName Text, bool SkipRoot);
+    static bool Less(const FSortKey& A, const FSortKey& B);
+
+    void Merge();
+
+    EAssetSortOrder Order = EAssetSortOrder::Path;
+
+    TArray<FSortKey> Run;
+    TArray<FSortKey> Pending;
+};
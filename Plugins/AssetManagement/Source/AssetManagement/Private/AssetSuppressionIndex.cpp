@@ -0,0 +1,130 @@
+#include "AssetSuppressionIndex.h"
+
+void AssetSuppressionIndex::Build(const TArray<FString>& Entries, const TArray<FString>& ActionNames)
+{
+    Nodes.Reset();
+    Nodes.AddDefaulted();
+
+    for (const FString& Entry : Entries)
+    {
+        FString Path;
+        FString Actions;
+        if (!Entry.Split(TEXT("|"), &Path, &Actions)) Path = Entry;
+        Path.TrimStartAndEndInline();
+        if (Path.IsEmpty()) continue;
+
+        uint32 Mask = 0;
+        TArray<FString> Names;
+        Actions.ParseIntoArray(Names, TEXT(";"), true);
+        for (FString& Name : Names)
+        {
+            const int32 Action = ActionNames.IndexOfByKey(Name.TrimStartAndEnd());
+            if (Action != INDEX_NONE && Action < 32) Mask |= 1u << Action;
+        }
+        if (Names.Num() == 0) Mask = AllActions;
+        if (Mask == 0) continue;
+
+        const bool Folder = Path.EndsWith(TEXT("/")) || Path.EndsWith(TEXT("/*")) || Path.EndsWith(TEXT("/**"));
+
+        TArray<FString> Segments;
+        Path.ParseIntoArray(Segments, TEXT("/"), true);
+        // Only a trailing * or ** stands for the folder contents, other wildcard segments like *Debug name folders
+        if (Folder && Segments.Num() > 0 && (Segments.Last() == TEXT("*") || Segments.Last() == TEXT("**"))) Segments.Pop();
+
+        // The last segment of an exact path is the package itself
+        FString PackageSegment;
+        if (!Folder && Segments.Num() > 0) PackageSegment = Segments.Pop();
+
+        int32 Node = 0;
+        for (const FString& Segment : Segments)
+        {
+            Node = FindOrAddChild(Node, Segment);
+        }
+
+        if (Folder) Nodes[Node].SubtreeMask |= Mask;
+        else if (IsWildcard(PackageSegment)) Nodes[Node].WildcardPackages.Add(TPair<FString, uint32>(PackageSegment, Mask));
+        else Nodes[Node].Packages.FindOrAdd(FName(*PackageSegment)) |= Mask;
+    }
+}
+
+uint32 AssetSuppressionIndex::GetSuppressedActions(FName PackageName) const
+{
+    if (IsEmpty()) return 0;
+
+    TArray<FString> Segments;
+    PackageName.ToString().ParseIntoArray(Segments, TEXT("/"), true);
+
+    uint32 Mask = 0;
+    Collect(0, Segments, 0, Mask);
+    return Mask;
+}
+
+void AssetSuppressionIndex::Collect(int32 Node, const TArray<FString>& Segments, int32 Segment, uint32& Mask) const
+{
+    const FNode& Current = Nodes[Node];
+    Mask |= Current.SubtreeMask;
+    if (Mask == AllActions || Segment >= Segments.Num()) return;
+
+    // The last segment is the package name, everything before it are folders
+    if (Segment == Segments.Num() - 1)
+    {
+        const uint32* PackageMask = Current.Packages.Find(FName(*Segments[Segment]));
+        if (PackageMask != nullptr) Mask |= *PackageMask;
+
+        for (const TPair<FString, uint32>& Wildcard : Current.WildcardPackages)
+        {
+            if (Segments[Segment].MatchesWildcard(Wildcard.Key)) Mask |= Wildcard.Value;
+        }
+        return;
+    }
+
+    const int32* Child = Current.Children.Find(FName(*Segments[Segment]));
+    if (Child != nullptr) Collect(*Child, Segments, Segment + 1, Mask);
+
+    for (const TPair<FString, int32>& Wildcard : Current.WildcardChildren)
+    {
+        if (Segments[Segment].MatchesWildcard(Wildcard.Key)) Collect(Wildcard.Value, Segments, Segment + 1, Mask);
+    }
+}
+
+bool AssetSuppressionIndex::IsWildcard(const FString& Segment)
+{
+    int32 Index;
+    return Segment.FindChar('*', Index) || Segment.FindChar('?', Index);
+}
+
+int32 AssetSuppressionIndex::FindOrAddChild(int32 Node, const FString& Segment)
+{
+    const bool Wildcard = IsWildcard(Segment);
+
+    if (Wildcard)
+    {
+        for (const TPair<FString, int32>& Child : Nodes[Node].WildcardChildren)
+        {
+            if (Child.Key == Segment) return Child.Value;
+        }
+    }
+    else
+    {
+        const int32* Child = Nodes[Node].Children.Find(FName(*Segment));
+        if (Child != nullptr) return *Child;
+    }
+
+    const int32 NewNode = Nodes.AddDefaulted();
+    if (Wildcard) Nodes[Node].WildcardChildren.Add(TPair<FString, int32>(Segment, NewNode));
+    else Nodes[Node].Children.Add(FName(*Segment), NewNode);
+
+    return NewNode;
+}
+
+TArray<FString> AssetSuppressionIndex::ParseEntries(const FString& Config)
+{
+    TArray<FString> Entries;
+    Config.ParseIntoArray(Entries, TEXT(","), true);
+    return Entries;
+}
+
+FString AssetSuppressionIndex::JoinEntries(const TArray<FString>& Entries)
+{
+    return FString::Join(Entries, TEXT(","));
+}
@@ -0,0 +1,36 @@
+#pragma once
+#include "CoreMinimal.h"
+
+// Suppressed packages and folders compiled into a path trie, a lookup walks the package path once
+// Entries are "<path>|<action>;<action>", without actions every action is suppressed
+// A path ending in "/", "/*" or "/**" covers the whole folder, segments may contain * and ? wildcards
+class AssetSuppressionIndex
+{
+public:
+    static const uint32 AllActions = 0xFFFFFFFF;
+
+    void Build(const TArray<FString>& Entries, const TArray<FString>& ActionNames);
+    bool IsEmpty() const { return Nodes.Num() <= 1; }
+
+    // Bit per action id, AllActions if the package is skipped completely
+    uint32 GetSuppressedActions(FName PackageName) const;
+
+    static TArray<FString> ParseEntries(const FString& Config);
+    static FString JoinEntries(const TArray<FString>& Entries);
+
+private:
+    struct FNode
+    {
+        TMap<FName, int32> Children;
+        TArray<TPair<FString, int32>> WildcardChildren;
+        TMap<FName, uint32> Packages;
+        TArray<TPair<FString, uint32>> WildcardPackages;
+        uint32 SubtreeMask = 0;
+    };
+
+    static bool IsWildcard(const FString& Segment);
+    int32 FindOrAddChild(int32 Node, const FString& Segment);
+    void Collect(int32 Node, const TArray<FString>& Segments, int32 Segment, uint32& Mask) const;
+
+    TArray<FNode> Nodes;
+};
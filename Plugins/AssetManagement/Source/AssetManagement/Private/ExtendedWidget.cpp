@@ -1,12 +1,12 @@
-#include "ExtendedWidget.h"
-
-void SExtendedWidget::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
-{
-    if (!started) 
-    {
-        started = true;
-        Start();
-    }
-
-    SCompoundWidget::Tick(AllottedGeometry, InCurrentTime, InDeltaTime);
-}
+#include "ExtendedWidget.h"
+
+void SExtendedWidget::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
+{
+    if (!started) 
+    {
+        started = true;
+        Start();
+    }
+
+    SCompoundWidget::Tick(AllottedGeometry, InCurrentTime, InDeltaTime);
+}
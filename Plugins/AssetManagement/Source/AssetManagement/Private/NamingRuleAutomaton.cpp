@@ -0,0 +1,458 @@
+#include "NamingRuleAutomaton.h"
+#include "AssetManagementModule.h"
+
+#define NUM_SYMBOLS 129
+#define MAX_GROUP_RULES 64
+#define MAX_GROUP_STATES 4096
+
+void NamingRuleAutomaton::FSymbolSet::AddRange(TCHAR First, TCHAR Last)
+{
+    for (int32 Char = First; Char <= Last && Char < 128; Char++)
+    {
+        Add(Char);
+    }
+
+    // Every non ASCII character shares one symbol, a range reaching past ASCII includes it
+    if (Last >= 128) Add(128);
+}
+
+void NamingRuleAutomaton::FSymbolSet::Invert()
+{
+    for (int32 Symbol = 0; Symbol < NUM_SYMBOLS; Symbol++)
+    {
+        Bits[Symbol >> 5] ^= 1u << (Symbol & 31);
+    }
+}
+
+void NamingRuleAutomaton::Build(const TArray<FString>& Expressions)
+{
+    Groups.Empty();
+
+    TArray<int32> Rules;
+    for (int32 i = 0; i < Expressions.Num(); i++)
+    {
+        Rules.Add(i);
+
+        if (Rules.Num() == MAX_GROUP_RULES)
+        {
+            SplitGroup(Expressions, Rules);
+            Rules.Reset();
+        }
+    }
+
+    if (Rules.Num() > 0) SplitGroup(Expressions, Rules);
+}
+
+int32 NamingRuleAutomaton::FindViolation(const FString& Name) const
+{
+    int32 Violation = INDEX_NONE;
+
+    for (const FGroup& Group : Groups)
+    {
+        int32 State = 1;
+        for (int32 i = 0; i < Name.Len() && State != 0; i++)
+        {
+            State = Group.Transitions[State * NUM_SYMBOLS + GetSymbol(Name[i])];
+        }
+
+        const uint64 Failed = Group.AllRules & ~Group.Accept[State];
+        if (Failed == 0) continue;
+
+        for (int32 Bit = 0; Bit < Group.Rules.Num(); Bit++)
+        {
+            if ((Failed & (1ull << Bit)) == 0) continue;
+
+            if (Violation == INDEX_NONE || Group.Rules[Bit] < Violation) Violation = Group.Rules[Bit];
+            break;
+        }
+    }
+
+    return Violation;
+}
+
+FString NamingRuleAutomaton::GlobToRegex(const FString& Glob)
+{
+    FString Regex;
+    bool InClass = false;
+    int32 Alternations = 0;
+
+    for (int32 i = 0; i < Glob.Len(); i++)
+    {
+        const TCHAR Char = Glob[i];
+
+        if (InClass)
+        {
+            if (Char == ']') InClass = false;
+            Regex.AppendChar(Char);
+            continue;
+        }
+
+        switch (Char)
+        {
+        case '*': Regex += TEXT(".*"); break;
+        case '?': Regex += TEXT("."); break;
+        case '[':
+            InClass = true;
+            Regex.AppendChar('[');
+            if (i + 1 < Glob.Len() && Glob[i + 1] == '!')
+            {
+                Regex.AppendChar('^');
+                i++;
+            }
+            break;
+        case '{':
+            Alternations++;
+            Regex.AppendChar('(');
+            break;
+        case '}':
+            if (Alternations > 0)
+            {
+                Alternations--;
+                Regex.AppendChar(')');
+            }
+            else
+            {
+                Regex += TEXT("\\}");
+            }
+            break;
+        case ',':
+            Regex += Alternations > 0 ? TEXT("|") : TEXT(",");
+            break;
+        case '.': case '(': case ')': case '|': case '+': case '\\': case '^': case '$':
+            Regex.AppendChar('\\');
+            Regex.AppendChar(Char);
+            break;
+        default:
+            Regex.AppendChar(Char);
+            break;
+        }
+    }
+
+    return Regex;
+}
+
+void NamingRuleAutomaton::SplitGroup(const TArray<FString>& Expressions, const TArray<int32>& Rules)
+{
+    if (BuildGroup(Expressions, Rules)) return;
+
+    if (Rules.Num() == 1)
+    {
+        UE_LOG(AssetManagementLog, Warning, TEXT("Naming rule '%s' is too complex and is ignored"), *Expressions[Rules[0]]);
+        return;
+    }
+
+    // Combined rules can multiply their states, smaller groups keep each DFA bounded
+    const int32 Half = Rules.Num() / 2;
+    SplitGroup(Expressions, TArray<int32>(Rules.GetData(), Half));
+    SplitGroup(Expressions, TArray<int32>(Rules.GetData() + Half, Rules.Num() - Half));
+}
+
+bool NamingRuleAutomaton::BuildGroup(const TArray<FString>& Expressions, const TArray<int32>& Rules)
+{
+    TArray<FNfaState> States;
+    const int32 Start = States.AddDefaulted();
+
+    FGroup Group;
+    for (int32 Rule : Rules)
+    {
+        const int32 FirstState = States.Num();
+
+        FFragment Fragment;
+        FParser Parser(Expressions[Rule], States);
+        if (!Parser.Parse(Fragment))
+        {
+            UE_LOG(AssetManagementLog, Warning, TEXT("Failed to parse naming rule '%s'"), *Expressions[Rule]);
+            States.SetNum(FirstState);
+            continue;
+        }
+
+        States[Fragment.End].AcceptRule = Group.Rules.Num();
+        States[Start].Epsilon.Add(Fragment.Start);
+
+        Group.AllRules |= 1ull << Group.Rules.Num();
+        Group.Rules.Add(Rule);
+    }
+
+    if (Group.Rules.Num() == 0) return true;
+
+    // State 0 is the dead state, state 1 the start, every other state is created by subset construction
+    TArray<TArray<int32>> Sets;
+    TMap<FString, int32> SetIds;
+
+    auto AddSet = [&](TArray<int32>& Set) -> int32
+    {
+        FString Key;
+        for (int32 State : Set)
+        {
+            // 15 bits per character, so the key never contains a terminator or depends on the TCHAR width
+            Key.AppendChar(static_cast<TCHAR>((State & 0x7FFF) + 1));
+            Key.AppendChar(static_cast<TCHAR>((State >> 15) + 1));
+        }
+
+        const int32* Existing = SetIds.Find(Key);
+        if (Existing != nullptr) return *Existing;
+
+        const int32 Id = Sets.Add(Set);
+        SetIds.Add(Key, Id);
+
+        uint64 Accept = 0;
+        for (int32 State : Set)
+        {
+            if (States[State].AcceptRule != INDEX_NONE) Accept |= 1ull << States[State].AcceptRule;
+        }
+        Group.Accept.Add(Accept);
+
+        return Id;
+    };
+
+    TArray<int32> Dead;
+    AddSet(Dead);
+
+    TArray<int32> Initial = { Start };
+    Closure(States, Initial);
+    AddSet(Initial);
+
+    for (int32 Current = 1; Current < Sets.Num(); Current++)
+    {
+        if (Sets.Num() > MAX_GROUP_STATES) return false;
+
+        Group.Transitions.SetNumZeroed((Current + 1) * NUM_SYMBOLS);
+
+        for (int32 Symbol = 0; Symbol < NUM_SYMBOLS; Symbol++)
+        {
+            TArray<int32> Next;
+            for (int32 State : Sets[Current])
+            {
+                const FNfaState& NfaState = States[State];
+                if (NfaState.Next != INDEX_NONE && NfaState.Symbols.Contains(Symbol)) Next.AddUnique(NfaState.Next);
+            }
+
+            if (Next.Num() == 0) continue;
+
+            Closure(States, Next);
+            Group.Transitions[Current * NUM_SYMBOLS + Symbol] = AddSet(Next);
+        }
+    }
+
+    Group.Transitions.SetNumZeroed(Sets.Num() * NUM_SYMBOLS);
+    Groups.Add(MoveTemp(Group));
+
+    return true;
+}
+
+void NamingRuleAutomaton::Closure(const TArray<FNfaState>& States, TArray<int32>& Set)
+{
+    TBitArray<> Visited(false, States.Num());
+    TArray<int32> Stack = Set;
+    Set.Reset();
+
+    while (Stack.Num() > 0)
+    {
+        const int32 State = Stack.Pop(false);
+        if (Visited[State]) continue;
+
+        Visited[State] = true;
+        Set.Add(State);
+        Stack.Append(States[State].Epsilon);
+    }
+
+    Set.Sort();
+}
+
+bool NamingRuleAutomaton::FParser::Parse(FFragment& OutFragment)
+{
+    // Expressions always match the whole name, explicit anchors are accepted and ignored
+    if (Peek() == '^') Position++;
+
+    OutFragment = ParseAlternation();
+
+    if (Position < Expression.Len() && Expression[Position] == '$' && Position == Expression.Len() - 1) Position++;
+    return !Error && Position == Expression.Len();
+}
+
+NamingRuleAutomaton::FFragment NamingRuleAutomaton::FParser::ParseAlternation()
+{
+    FFragment Fragment = ParseConcatenation();
+
+    while (!Error && Peek() == '|')
+    {
+        Position++;
+        const FFragment Other = ParseConcatenation();
+
+        const int32 Start = NewState();
+        const int32 End = NewState();
+        States[Start].Epsilon.Add(Fragment.Start);
+        States[Start].Epsilon.Add(Other.Start);
+        States[Fragment.End].Epsilon.Add(End);
+        States[Other.End].Epsilon.Add(End);
+
+        Fragment = { Start, End };
+    }
+
+    return Fragment;
+}
+
+NamingRuleAutomaton::FFragment NamingRuleAutomaton::FParser::ParseConcatenation()
+{
+    const int32 Start = NewState();
+    FFragment Fragment = { Start, Start };
+
+    while (!Error && Position < Expression.Len() && Peek() != '|' && Peek() != ')')
+    {
+        if (Peek() == '$' && Position == Expression.Len() - 1) break;
+
+        const FFragment Next = ParseRepetition();
+        States[Fragment.End].Epsilon.Add(Next.Start);
+        Fragment.End = Next.End;
+    }
+
+    return Fragment;
+}
+
+NamingRuleAutomaton::FFragment NamingRuleAutomaton::FParser::ParseRepetition()
+{
+    FFragment Fragment = ParseAtom();
+
+    while (!Error && (Peek() == '*' || Peek() == '+' || Peek() == '?'))
+    {
+        const TCHAR Operator = Expression[Position++];
+
+        const int32 End = NewState();
+        States[Fragment.End].Epsilon.Add(End);
+
+        if (Operator == '+')
+        {
+            States[Fragment.End].Epsilon.Add(Fragment.Start);
+            Fragment = { Fragment.Start, End };
+            continue;
+        }
+
+        const int32 Start = NewState();
+        States[Start].Epsilon.Add(Fragment.Start);
+        States[Start].Epsilon.Add(End);
+        if (Operator == '*') States[Fragment.End].Epsilon.Add(Fragment.Start);
+
+        Fragment = { Start, End };
+    }
+
+    return Fragment;
+}
+
+NamingRuleAutomaton::FFragment NamingRuleAutomaton::FParser::ParseAtom()
+{
+    FSymbolSet Symbols;
+    const TCHAR Char = Peek();
+    Position++;
+
+    switch (Char)
+    {
+    case '(':
+    {
+        const FFragment Fragment = ParseAlternation();
+        if (Peek() != ')') Error = true;
+        Position++;
+        return Fragment;
+    }
+    case '[':
+        ParseClass(Symbols);
+        break;
+    case '.':
+        Symbols.Invert();
+        break;
+    case '\\':
+        if (!ParseEscape(Symbols)) Error = true;
+        break;
+    case 0: case ')': case '*': case '+': case '?':
+        Error = true;
+        break;
+    default:
+        Symbols.Add(GetSymbol(Char));
+        break;
+    }
+
+    return MakeAtom(Symbols);
+}
+
+void NamingRuleAutomaton::FParser::ParseClass(FSymbolSet& OutSymbols)
+{
+    const bool Negate = Peek() == '^';
+    if (Negate) Position++;
+
+    bool First = true;
+    while (!Error && (First || Peek() != ']'))
+    {
+        First = false;
+
+        TCHAR Char = Peek();
+        if (Char == 0)
+        {
+            Error = true;
+            return;
+        }
+
+        Position++;
+        if (Char == '\\')
+        {
+            if (!ParseEscape(OutSymbols)) Error = true;
+            continue;
+        }
+
+        if (Peek() == '-' && Position + 1 < Expression.Len() && Expression[Position + 1] != ']')
+        {
+            const TCHAR Last = Expression[Position + 1];
+            Position += 2;
+            OutSymbols.AddRange(Char, Last);
+        }
+        else
+        {
+            OutSymbols.Add(GetSymbol(Char));
+        }
+    }
+
+    Position++;
+    if (Negate) OutSymbols.Invert();
+}
+
+bool NamingRuleAutomaton::FParser::ParseEscape(FSymbolSet& OutSymbols)
+{
+    const TCHAR Char = Peek();
+    if (Char == 0) return false;
+    Position++;
+
+    switch (Char)
+    {
+    case 'd':
+        OutSymbols.AddRange('0', '9');
+        break;
+    case 'w':
+        OutSymbols.AddRange('a', 'z');
+        OutSymbols.AddRange('A', 'Z');
+        OutSymbols.AddRange('0', '9');
+        OutSymbols.Add('_');
+        break;
+    case 's':
+        OutSymbols.Add(' ');
+        OutSymbols.Add('\t');
+        break;
+    default:
+        OutSymbols.Add(GetSymbol(Char));
+        break;
+    }
+
+    return true;
+}
+
+int32 NamingRuleAutomaton::FParser::NewState()
+{
+    return States.AddDefaulted();
+}
+
+NamingRuleAutomaton::FFragment NamingRuleAutomaton::FParser::MakeAtom(const FSymbolSet& Symbols)
+{
+    const int32 Start = NewState();
+    const int32 End = NewState();
+    States[Start].Symbols = Symbols;
+    States[Start].Next = End;
+
+    return { Start, End };
+}
@@ -0,0 +1,84 @@
+#pragma once
+#include "CoreMinimal.h"
+
+// Matches a name against a set of regular expressions in one pass, all expressions are combined into a DFA
+// Supported syntax: literals, ., [], [^], \d \w \s, (), |, *, + and ?, every expression has to match the whole name
+class NamingRuleAutomaton
+{
+public:
+    // Expressions that fail to parse are reported and never count as violated
+    void Build(const TArray<FString>& Expressions);
+
+    // Index of the first expression the name does not match, INDEX_NONE if it matches all of them
+    int32 FindViolation(const FString& Name) const;
+
+    bool IsEmpty() const { return Groups.Num() == 0; }
+
+    static FString GlobToRegex(const FString& Glob);
+
+private:
+    struct FSymbolSet
+    {
+        uint32 Bits[5] = { 0, 0, 0, 0, 0 };
+
+        void Add(int32 Symbol) { Bits[Symbol >> 5] |= 1u << (Symbol & 31); }
+        bool Contains(int32 Symbol) const { return (Bits[Symbol >> 5] & (1u << (Symbol & 31))) != 0; }
+        void AddRange(TCHAR First, TCHAR Last);
+        void Invert();
+    };
+
+    struct FNfaState
+    {
+        FSymbolSet Symbols;
+        int32 Next = INDEX_NONE;
+        TArray<int32> Epsilon;
+        int32 AcceptRule = INDEX_NONE;
+    };
+
+    struct FFragment
+    {
+        int32 Start;
+        int32 End;
+    };
+
+    // Rules are split into groups of at most 64 so every DFA state can keep its accepted rules in a mask
+    struct FGroup
+    {
+        TArray<int32> Transitions;
+        TArray<uint64> Accept;
+        TArray<int32> Rules;
+        uint64 AllRules = 0;
+    };
+
+    class FParser
+    {
+    public:
+        FParser(const FString& InExpression, TArray<FNfaState>& InStates) : Expression(InExpression), States(InStates) { }
+        bool Parse(FFragment& OutFragment);
+
+    private:
+        FFragment ParseAlternation();
+        FFragment ParseConcatenation();
+        FFragment ParseRepetition();
+        FFragment ParseAtom();
+        void ParseClass(FSymbolSet& OutSymbols);
+        bool ParseEscape(FSymbolSet& OutSymbols);
+
+        int32 NewState();
+        FFragment MakeAtom(const FSymbolSet& Symbols);
+        TCHAR Peek() const { return Position < Expression.Len() ? Expression[Position] : 0; }
+
+        const FString& Expression;
+        TArray<FNfaState>& States;
+        int32 Position = 0;
+        bool Error = false;
+    };
+
+    static int32 GetSymbol(TCHAR Char) { return Char < 128 ? static_cast<int32>(Char) : 128; }
+
+    bool BuildGroup(const TArray<FString>& Expressions, const TArray<int32>& Rules);
+    void SplitGroup(const TArray<FString>& Expressions, const TArray<int32>& Rules);
+    static void Closure(const TArray<FNfaState>& States, TArray<int32>& Set);
+
+    TArray<FGroup> Groups;
+};
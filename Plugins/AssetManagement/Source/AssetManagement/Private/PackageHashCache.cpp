@@ -0,0 +1,206 @@
+#include "PackageHashCache.h"
+#include "HAL/FileManager.h"
+#include "AssetScanWorkers.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "UObject/PackageFileSummary.h"
+#include "Engine/World.h"
+
+#define HASH_CACHE_MAGIC 0x414D4843
+#define HASH_CACHE_VERSION 2
+#define HASH_STREAM_CHUNK_SIZE (256 * 1024)
+
+PackageHashCache& PackageHashCache::Get()
+{
+    static PackageHashCache instance;
+    instance.Load();
+    return instance;
+}
+
+FArchive& operator<<(FArchive& Ar, FPackageHashEntry& Entry)
+{
+    uint8 Types = static_cast<uint8>(Entry.ValidTypes);
+    Ar << Entry.FileSize << Entry.Timestamp << Types << Entry.PayloadSize << Entry.PayloadHash << Entry.FileHash << Entry.SummaryHash;
+    Entry.ValidTypes = static_cast<EPackageHashType>(Types);
+    return Ar;
+}
+
+void PackageHashCache::Update(const TArray<FString>& Filenames, EPackageHashType Types)
+{
+    TArray<FPackageHashEntry> Results;
+    Results.SetNum(Filenames.Num());
+    TArray<bool> Changed;
+    Changed.SetNumZeroed(Filenames.Num());
+
+    // Entries is only read here, all writes happen after the parallel section
+    AssetScanWorkers::Get().ParallelFor(Filenames.Num(), [&](int32 Index)
+    {
+        FFileStatData Stat = IFileManager::Get().GetStatData(*Filenames[Index]);
+        if (!Stat.bIsValid) return;
+
+        FPackageHashEntry Entry;
+        EPackageHashType Missing = Types;
+
+        const FPackageHashEntry* Cached = Entries.Find(Filenames[Index]);
+        if (Cached != nullptr && Cached->FileSize == Stat.FileSize && Cached->Timestamp == Stat.ModificationTime)
+        {
+            Entry = *Cached;
+            Missing = Types & ~Cached->ValidTypes;
+        }
+        else
+        {
+            Entry.FileSize = Stat.FileSize;
+            Entry.Timestamp = Stat.ModificationTime;
+        }
+
+        if (Missing == EPackageHashType::None) return;
+
+        if (ComputeEntry(Filenames[Index], Missing, Entry))
+        {
+            Results[Index] = Entry;
+            Changed[Index] = true;
+        }
+    });
+
+    for (int32 i = 0; i < Filenames.Num(); i++)
+    {
+        if (Changed[i])
+        {
+            Entries.Add(Filenames[i], Results[i]);
+            dirty = true;
+        }
+    }
+}
+
+const FPackageHashEntry* PackageHashCache::Find(const FString& Filename) const
+{
+    return Entries.Find(Filename);
+}
+
+bool PackageHashCache::ComputeEntry(const FString& Filename, EPackageHashType Types, FPackageHashEntry& Entry)
+{
+    TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*Filename));
+    if (!Reader.IsValid()) return false;
+
+    const int64 TotalSize = Reader->TotalSize();
+
+    FPackageFileSummary Summary;
+    *Reader << Summary;
+    if (Reader->IsError() || Summary.TotalHeaderSize <= 0 || Summary.TotalHeaderSize > TotalSize) return false;
+
+    // Only the first few kilobytes are read, the rest of the file is skipped
+    if (EnumHasAnyFlags(Types, EPackageHashType::SummaryHash))
+    {
+        const int64 SummarySize = Reader->Tell();
+
+        TArray<uint8> SummaryData;
+        SummaryData.SetNumUninitialized(SummarySize);
+        Reader->Seek(0);
+        Reader->Serialize(SummaryData.GetData(), SummarySize);
+        if (Reader->IsError()) return false;
+
+        FSHA1::HashBuffer(SummaryData.GetData(), SummaryData.Num(), Entry.SummaryHash.Hash);
+        Entry.ValidTypes |= EPackageHashType::SummaryHash;
+    }
+
+    // Bulk data holds the actual texture, mesh and sound content, the header differs per asset name
+    int64 PayloadStart = Summary.BulkDataStartOffset > 0 ? Summary.BulkDataStartOffset : Summary.TotalHeaderSize;
+    PayloadStart = FMath::Clamp<int64>(PayloadStart, 0, TotalSize);
+
+    Entry.PayloadSize = TotalSize - PayloadStart;
+    Entry.ValidTypes |= EPackageHashType::PayloadSize;
+
+    const bool HashFile = EnumHasAnyFlags(Types, EPackageHashType::FileHash);
+    const bool HashPayload = EnumHasAnyFlags(Types, EPackageHashType::PayloadHash);
+    if (!HashFile && !HashPayload) return true;
+
+    FSHA1 FileSha;
+    FSHA1 PayloadSha;
+
+    TArray<uint8> Buffer;
+    Buffer.SetNumUninitialized(HASH_STREAM_CHUNK_SIZE);
+
+    int64 Offset = HashFile ? 0 : PayloadStart;
+    Reader->Seek(Offset);
+
+    while (Offset < TotalSize)
+    {
+        AssetScanWorkers::YieldPoint();
+
+        const int64 Count = FMath::Min<int64>(HASH_STREAM_CHUNK_SIZE, TotalSize - Offset);
+        Reader->Serialize(Buffer.GetData(), Count);
+        if (Reader->IsError()) return false;
+
+        if (HashFile)
+        {
+            FileSha.Update(Buffer.GetData(), static_cast<uint32>(Count));
+        }
+
+        if (HashPayload)
+        {
+            const int64 Skip = FMath::Clamp<int64>(PayloadStart - Offset, 0, Count);
+            if (Skip < Count) PayloadSha.Update(Buffer.GetData() + Skip, static_cast<uint32>(Count - Skip));
+        }
+
+        Offset += Count;
+    }
+
+    if (HashFile)
+    {
+        FileSha.Final();
+        FileSha.GetHash(Entry.FileHash.Hash);
+        Entry.ValidTypes |= EPackageHashType::FileHash;
+    }
+
+    if (HashPayload)
+    {
+        PayloadSha.Final();
+        PayloadSha.GetHash(Entry.PayloadHash.Hash);
+        Entry.ValidTypes |= EPackageHashType::PayloadHash;
+    }
+
+    return true;
+}
+
+void PackageHashCache::Load()
+{
+    if (loaded) return;
+    loaded = true;
+
+    TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*GetCacheFile()));
+    if (!Reader.IsValid()) return;
+
+    uint32 Magic = 0;
+    uint32 Version = 0;
+    *Reader << Magic << Version;
+    if (Magic != HASH_CACHE_MAGIC || Version != HASH_CACHE_VERSION) return;
+
+    *Reader << Entries;
+    if (Reader->IsError()) Entries.Empty();
+}
+
+void PackageHashCache::Save()
+{
+    if (!dirty) return;
+
+    TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*GetCacheFile()));
+    if (!Writer.IsValid()) return;
+
+    uint32 Magic = HASH_CACHE_MAGIC;
+    uint32 Version = HASH_CACHE_VERSION;
+    *Writer << Magic << Version;
+    *Writer << Entries;
+
+    dirty = false;
+}
+
+FString PackageHashCache::GetPackageFilename(const FAssetData& Asset)
+{
+    const FString Extension = Asset.AssetClass == UWorld::StaticClass()->GetFName() ? FPackageName::GetMapPackageExtension() : FPackageName::GetAssetPackageExtension();
+    return FPackageName::LongPackageNameToFilename(Asset.PackageName.ToString(), Extension);
+}
+
+FString PackageHashCache::GetCacheFile()
+{
+    return FPaths::Combine(FPaths::ProjectSavedDir(), FString("AssetManagement"), FString("PackageHashes.bin"));
+}
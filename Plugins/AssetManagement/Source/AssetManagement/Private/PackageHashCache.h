@@ -0,0 +1,52 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "Misc/SecureHash.h"
+#include "AssetData.h"
+
+enum class EPackageHashType : uint8
+{
+    None        = 0,
+    PayloadSize = 1 << 0,   // Size of the bulk data payload, only requires reading the package summary
+    PayloadHash = 1 << 1,   // Hash of the bulk data payload (source art, mesh and sound data)
+    FileHash    = 1 << 2,   // Hash of the complete package file
+    SummaryHash = 1 << 3    // Hash of the package summary, which holds a guid that changes whenever the package is saved
+};
+ENUM_CLASS_FLAGS(EPackageHashType)
+
+struct FPackageHashEntry
+{
+    int64 FileSize = 0;
+    FDateTime Timestamp;
+
+    EPackageHashType ValidTypes = EPackageHashType::None;
+    int64 PayloadSize = 0;
+    FSHAHash PayloadHash;
+    FSHAHash FileHash;
+    FSHAHash SummaryHash;
+
+    friend FArchive& operator<<(FArchive& Ar, FPackageHashEntry& Entry);
+};
+
+// Persistent cache of package file hashes, keyed by file name and invalidated by size and timestamp
+class PackageHashCache
+{
+public:
+    static PackageHashCache& Get();
+
+    // Make sure the requested hash types are available for all given files, computing stale entries in parallel
+    void Update(const TArray<FString>& Filenames, EPackageHashType Types);
+    const FPackageHashEntry* Find(const FString& Filename) const;
+
+    void Load();
+    void Save();
+
+    static FString GetPackageFilename(const FAssetData& Asset);
+
+private:
+    static bool ComputeEntry(const FString& Filename, EPackageHashType Types, FPackageHashEntry& Entry);
+    static FString GetCacheFile();
+
+    TMap<FString, FPackageHashEntry> Entries;
+    bool loaded = false;
+    bool dirty = false;
+};
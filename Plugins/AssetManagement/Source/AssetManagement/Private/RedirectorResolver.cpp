@@ -0,0 +1,156 @@
+#include "RedirectorResolver.h"
+#include "AssetLoader.h"
+#include "AssetManagementModule.h"
+#include "AssetRegistryModule.h"
+#include "AssetToolsModule.h"
+#include "Misc/PackageName.h"
+#include "UObject/ObjectRedirector.h"
+
+void RedirectorResolver::Build(IAssetRegistry& AssetRegistry)
+{
+    Redirectors.Reset();
+    Targets.Reset();
+    FinalTargets.Reset();
+
+    FARFilter filter;
+    filter.ClassNames.Add(UObjectRedirector::StaticClass()->GetFName());
+    filter.bRecursivePaths = true;
+    filter.PackagePaths.Add("/Game");
+
+    TArray<FAssetData> Assets;
+    AssetRegistry.GetAssets(filter, Assets);
+
+    TArray<FName> Dependencies;
+    for (FAssetData& Asset : Assets)
+    {
+        // Only the main asset of a package is a package redirector, others redirect objects inside a package
+        if (!Asset.AssetName.ToString().Equals(FPackageName::GetShortName(Asset.PackageName))) continue;
+
+        FString Value;
+        FName Target = Asset.GetTagValue("DestinationObject", Value) ? ParseDestination(Value) : NAME_None;
+
+        // Packages saved without the tag only depend on their destination
+        if (Target.IsNone())
+        {
+            Dependencies.Reset();
+            AssetRegistry.GetDependencies(Asset.PackageName, Dependencies);
+            for (FName& Dependency : Dependencies)
+            {
+                if (Dependency.ToString().StartsWith("/Script/")) continue;
+
+                Target = Dependency;
+                break;
+            }
+        }
+
+        if (Target.IsNone() || Target == Asset.PackageName) continue;
+
+        Redirectors.Add(Asset.PackageName, Asset);
+        Targets.Add(Asset.PackageName, Target);
+    }
+
+    // Chains are collapsed once, so resolving is a single lookup
+    for (auto& Target : Targets)
+    {
+        FName Current = Target.Value;
+        int32 Steps = 0;
+
+        const FName* Next = Targets.Find(Current);
+        while (Next != nullptr && Steps <= Targets.Num())
+        {
+            Current = *Next;
+            Next = Targets.Find(Current);
+            Steps++;
+        }
+
+        if (Next != nullptr)
+        {
+            UE_LOG(AssetManagementLog, Warning, TEXT("Redirector %s is part of a redirect loop"), *Target.Key.ToString());
+            Current = NAME_None;
+        }
+
+        FinalTargets.Add(Target.Key, Current);
+    }
+}
+
+FName RedirectorResolver::Resolve(FName PackageName) const
+{
+    const FName* Target = FinalTargets.Find(PackageName);
+    return Target != nullptr ? *Target : NAME_None;
+}
+
+int32 RedirectorResolver::Fix(const TArray<FName>& PackageNames, IAssetRegistry& AssetRegistry, AssetLoader& Loader) const
+{
+    // Intermediate redirectors are fixed in the same pass, otherwise their referencers would only move one step along the chain
+    TSet<FName> Chains;
+    for (FName PackageName : PackageNames)
+    {
+        FName Current = PackageName;
+        while (Redirectors.Contains(Current) && !Chains.Contains(Current))
+        {
+            Chains.Add(Current);
+            Current = Targets.FindChecked(Current);
+        }
+    }
+
+    if (Chains.Num() == 0) return 0;
+
+    TSet<FName> Referencers;
+    TArray<FName> PackageReferencers;
+    for (FName PackageName : Chains)
+    {
+        PackageReferencers.Reset();
+        AssetRegistry.GetReferencers(PackageName, PackageReferencers);
+        for (FName& Referencer : PackageReferencers)
+        {
+            if (!Chains.Contains(Referencer)) Referencers.Add(Referencer);
+        }
+    }
+
+    // Referencing packages are loaded in overlapping batches up front, the fixup then finds them in memory
+    TArray<FAssetData> PackageAssets;
+    for (FName Referencer : Referencers)
+    {
+        PackageAssets.Reset();
+        AssetRegistry.GetAssetsByPackageName(Referencer, PackageAssets);
+        if (PackageAssets.Num() > 0) Loader.Request(PackageAssets[0], [](UObject*) { });
+    }
+
+    TArray<UObjectRedirector*> Objects;
+    for (FName PackageName : Chains)
+    {
+        Loader.Request(Redirectors.FindChecked(PackageName), [&Objects](UObject* Object)
+        {
+            UObjectRedirector* Redirector = Cast<UObjectRedirector>(Object);
+            if (Redirector != nullptr) Objects.AddUnique(Redirector);
+        });
+    }
+
+    Loader.Flush(true);
+
+    if (Objects.Num() == 0) return 0;
+
+    // A single fixup collects the referencers of all redirectors, so each package is resaved once
+    FAssetToolsModule& AssetToolsModule = FModuleManager::LoadModuleChecked<FAssetToolsModule>(TEXT("AssetTools"));
+    AssetToolsModule.Get().FixupReferencers(Objects);
+
+    return Objects.Num();
+}
+
+FName RedirectorResolver::ParseDestination(const FString& Value)
+{
+    // Stored as the full name "Class /Game/Path/Asset.Asset", export text "Class'/Game/Path/Asset.Asset'" is accepted as well
+    FString Path = Value;
+
+    int32 Index;
+    if (Path.FindLastChar(' ', Index)) Path = Path.Mid(Index + 1);
+    if (Path.FindChar('\'', Index))
+    {
+        Path = Path.Mid(Index + 1);
+        Path.RemoveFromEnd(TEXT("'"));
+    }
+
+    if (!Path.StartsWith("/")) return NAME_None;
+
+    return FName(*FPackageName::ObjectPathToPackageName(Path));
+}
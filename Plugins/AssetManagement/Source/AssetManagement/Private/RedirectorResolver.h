@@ -0,0 +1,28 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "AssetData.h"
+
+class IAssetRegistry;
+class AssetLoader;
+
+// Redirect graph of every redirector in the project, built from registry data without loading any package
+class RedirectorResolver
+{
+public:
+    void Build(IAssetRegistry& AssetRegistry);
+
+    // Final destination package after following the whole chain, NAME_None if the package is no redirector or the chain loops
+    FName Resolve(FName PackageName) const;
+
+    void GetRedirectors(TArray<FName>& OutPackageNames) const { Redirectors.GenerateKeyArray(OutPackageNames); }
+
+    // Fixes the redirectors together with the rest of their chains in one pass, every referencing package is loaded and saved once
+    int32 Fix(const TArray<FName>& PackageNames, IAssetRegistry& AssetRegistry, AssetLoader& Loader) const;
+
+private:
+    static FName ParseDestination(const FString& Value);
+
+    TMap<FName, FAssetData> Redirectors;
+    TMap<FName, FName> Targets;
+    TMap<FName, FName> FinalTargets;
+};
@@ -0,0 +1,89 @@
+#include "SharedScanCache.h"
+#include "AssetMagementConfig.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Guid.h"
+#include "Misc/Paths.h"
+
+#define SHARED_CACHE_VERSION 2
+#define ENTRY_HEADER_SIZE 5
+
+void SharedScanCache::Open()
+{
+    Directory = AssetManagerConfig::Get().GetString("Cache", "SharedDirectory", "");
+    if (!Directory.IsEmpty() && FPaths::IsRelative(Directory)) Directory = FPaths::ConvertRelativePathToFull(FPaths::ProjectDir(), Directory);
+}
+
+FSHAHash SharedScanCache::MakeKey(const FSHAHash* PackageHash, FName PackageName, const FString& Inputs, const FString& ActionName, uint32 ConfigFingerprint)
+{
+    FSHA1 Sha;
+
+    uint32 Version = SHARED_CACHE_VERSION;
+    Sha.Update(reinterpret_cast<const uint8*>(&Version), sizeof(Version));
+
+    uint8 HasPackageHash = PackageHash != nullptr ? 1 : 0;
+    Sha.Update(&HasPackageHash, sizeof(HasPackageHash));
+    if (PackageHash != nullptr) Sha.Update(PackageHash->Hash, sizeof(PackageHash->Hash));
+
+    // Names are part of the key because naming results depend on them while a moved package keeps its content.
+    // Strings are hashed with their terminator so neighbouring fields can't run into each other
+    FTCHARToUTF8 Package(*PackageName.ToString());
+    Sha.Update(reinterpret_cast<const uint8*>(Package.Get()), Package.Length() + 1);
+    FTCHARToUTF8 Input(*Inputs);
+    Sha.Update(reinterpret_cast<const uint8*>(Input.Get()), Input.Length() + 1);
+    FTCHARToUTF8 Action(*ActionName);
+    Sha.Update(reinterpret_cast<const uint8*>(Action.Get()), Action.Length() + 1);
+    Sha.Update(reinterpret_cast<const uint8*>(&ConfigFingerprint), sizeof(ConfigFingerprint));
+
+    FSHAHash Key;
+    Sha.Final();
+    Sha.GetHash(Key.Hash);
+    return Key;
+}
+
+bool SharedScanCache::Fetch(const FSHAHash& Key, bool& OutHasResult, FName& OutResult, int32& OutDetail) const
+{
+    TArray<uint8> Data;
+    if (!FFileHelper::LoadFileToArray(Data, *GetEntryPath(Key), FILEREAD_Silent) || Data.Num() < ENTRY_HEADER_SIZE) return false;
+
+    // First byte flags whether the action reported anything, followed by the detail and the UTF-8 result
+    OutHasResult = Data[0] != 0;
+    FMemory::Memcpy(&OutDetail, Data.GetData() + 1, sizeof(int32));
+    if (OutHasResult)
+    {
+        FUTF8ToTCHAR Converter(reinterpret_cast<const ANSICHAR*>(Data.GetData() + ENTRY_HEADER_SIZE), Data.Num() - ENTRY_HEADER_SIZE);
+        OutResult = FName(*FString(Converter.Length(), Converter.Get()));
+    }
+
+    return true;
+}
+
+void SharedScanCache::Store(const FSHAHash& Key, bool HasResult, FName Result, int32 Detail) const
+{
+    const FString Path = GetEntryPath(Key);
+    if (IFileManager::Get().FileExists(*Path)) return;
+
+    TArray<uint8> Data;
+    Data.Add(HasResult ? 1 : 0);
+    Data.Append(reinterpret_cast<const uint8*>(&Detail), sizeof(int32));
+    if (HasResult)
+    {
+        FTCHARToUTF8 Converter(*Result.ToString());
+        Data.Append(reinterpret_cast<const uint8*>(Converter.Get()), Converter.Length());
+    }
+
+    // Other workspaces may read the entry at any time, so it only appears once it is complete
+    const FString TempPath = Path + TEXT(".") + FGuid::NewGuid().ToString() + TEXT(".tmp");
+    if (!FFileHelper::SaveArrayToFile(Data, *TempPath)) return;
+
+    if (!IFileManager::Get().Move(*Path, *TempPath, false))
+    {
+        IFileManager::Get().Delete(*TempPath, false, false, true);
+    }
+}
+
+FString SharedScanCache::GetEntryPath(const FSHAHash& Key) const
+{
+    const FString Hex = Key.ToString();
+    return FPaths::Combine(Directory, Hex.Left(2), Hex.Mid(2) + TEXT(".res"));
+}
@@ -0,0 +1,25 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "Misc/SecureHash.h"
+
+// Content addressed store of per asset results in a directory shared between workspaces, a local folder or a network mount
+// Entries are keyed by everything the action reads from the asset, the action and its configuration, so they never have to be invalidated
+class SharedScanCache
+{
+public:
+    // Reads Cache.SharedDirectory, the cache is disabled while it is empty
+    void Open();
+    bool IsEnabled() const { return !Directory.IsEmpty(); }
+
+    // PackageHash is null for results that don't depend on the package contents
+    static FSHAHash MakeKey(const FSHAHash* PackageHash, FName PackageName, const FString& Inputs, const FString& ActionName, uint32 ConfigFingerprint);
+
+    // Safe to call from worker threads, a missing or unreadable entry is a miss. Detail is the action's own data behind the result
+    bool Fetch(const FSHAHash& Key, bool& OutHasResult, FName& OutResult, int32& OutDetail) const;
+    void Store(const FSHAHash& Key, bool HasResult, FName Result, int32 Detail) const;
+
+private:
+    FString GetEntryPath(const FSHAHash& Key) const;
+
+    FString Directory;
+};
@@ -0,0 +1,106 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "AssetData.h"
+#include "Features/IModularFeature.h"
+
+struct FAssetInfo
+{
+    FAssetData Data;
+    TMap<uint16, FName> ActionResults;
+    int64 PackageSize = 0;
+
+    // Bit per action id, actions skip their checks for suppressed assets
+    uint32 SuppressedActions = 0;
+    bool IsSuppressed(uint16 ActionId) const { return ActionId < 32 && (SuppressedActions & (1u << ActionId)) != 0; }
+};
+
+// Dry run estimate of an action, computed from the dependency graph without loading anything
+struct FAssetActionImpact
+{
+    int32 ResavedPackages = 0;
+    int32 DeletedPackages = 0;
+    int32 ReferencersTouched = 0;
+    int64 BytesWritten = 0;
+    int64 BytesDeleted = 0;
+
+    int32 GetModifiedPackages() const { return ResavedPackages + DeletedPackages; }
+
+    FString ToString() const
+    {
+        FString Text = FString::Printf(TEXT("%d package(s) modified and checked out: %d resaved, %d deleted\n%d referencing package(s) touched\n"),
+            GetModifiedPackages(), ResavedPackages, DeletedPackages, ReferencersTouched);
+
+        Text += "About " + FText::AsMemory(BytesWritten).ToString() + " written";
+        if (BytesDeleted > 0) Text += ", " + FText::AsMemory(BytesDeleted).ToString() + " deleted";
+
+        return Text;
+    }
+};
+
+// Data an action reads during a scan, names and paths are always available
+enum EAssetActionRequirements
+{
+    AAR_Names = 0,
+    AAR_RegistryTags = 1 << 0,
+    AAR_Dependencies = 1 << 1,
+    AAR_PackageFiles = 1 << 2,
+    AAR_LoadedObjects = 1 << 3,
+};
+
+enum EAssetActionGranularity
+{
+    AAG_PerAsset,   // A result only depends on the asset itself
+    AAG_WholeGraph, // A result depends on other assets, the action has to see the whole project
+};
+
+class IAssetAction
+{
+public:
+    virtual ~IAssetAction() = default;
+    virtual void ScanAssets(TArray<FAssetInfo>& Assets, uint16 AssignedId) = 0;
+
+    virtual void ExecuteAction(TArray<FAssetData> Assets) = 0;
+
+    virtual FString GetTooltipHeading() = 0;
+    virtual FString GetTooltipContent() = 0; //Use {Asset} for asset specific data
+    // Text {Asset} is replaced with, results are stored as compact FNames so long text is built when the tooltip opens
+    virtual FString FormatResult(FName Result) { return Result.ToString(); }
+    // False for results that are only reported, they are skipped by Apply all and their button stays disabled
+    virtual bool CanExecute(FName Result) { return true; }
+
+    virtual FString GetFilterName() = 0;
+    virtual FString GetApplyAllTag() = 0;
+
+    virtual FString GetButtonStyleName() = 0;
+
+    // Combination of EAssetActionRequirements, actions that don't declare anything are scheduled as the most expensive
+    virtual uint32 GetRequirements() { return AAR_RegistryTags | AAR_Dependencies | AAR_PackageFiles | AAR_LoadedObjects; }
+    virtual EAssetActionGranularity GetGranularity() { return AAG_WholeGraph; }
+    // Changes whenever the configuration that results depend on changes, cached results are only reused for the same value
+    virtual uint32 GetConfigFingerprint() { return 0; }
+    // Per asset actions list what they read from an asset besides its package name, results are shared between workspaces while it matches.
+    // True if the result also depends on the package contents, only then the package is read to add its hash to the key
+    virtual bool GetCacheInputs(const FAssetData& Asset, FString& OutInputs) { return true; }
+    // Data behind a result that FormatResult needs, stored with shared results and handed back when they are reused
+    virtual int32 GetResultDetail(FName Result) { return INDEX_NONE; }
+    virtual void RestoreResultDetail(FName Result, int32 Detail) { }
+
+    // Actions that modify packages estimate the work of applying them to a set of assets, false if there is nothing to estimate
+    virtual bool EstimateImpact(const TArray<FAssetData>& Assets, FAssetActionImpact& OutImpact) { return false; }
+    // True if the action shows its own confirmation including the estimate, the dry run dialog is skipped then
+    virtual bool ConfirmsExecution() { return false; }
+};
+
+// Register an implementation with IModularFeatures to add actions from another module
+class IAssetActionProvider : public IModularFeature
+{
+public:
+    static FName GetModularFeatureName()
+    {
+        static FName FeatureName = FName(TEXT("AssetManagementActionProvider"));
+        return FeatureName;
+    }
+
+    // Called once when the manager starts, or when the provider is registered later on
+    virtual void CreateActions(TArray<TSharedPtr<IAssetAction>>& OutActions) = 0;
+};
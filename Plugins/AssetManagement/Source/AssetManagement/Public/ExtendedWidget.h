@@ -1,12 +1,12 @@
-#pragma once
-#include "Widgets/SUserWidget.h"
-
-class SExtendedWidget : public SCompoundWidget 
-{
-public:
-    void Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime) override;
-    virtual void Start() {};
-
-private:
-    bool started = false;
+#pragma once
+#include "Widgets/SUserWidget.h"
+
+class SExtendedWidget : public SCompoundWidget 
+{
+public:
+    void Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime) override;
+    virtual void Start() {};
+
+private:
+    bool started = false;
 };
\ No newline at end of file
@@ -1,71 +1,107 @@
-#pragma once
-#include "CoreMinimal.h"
-#include "Actions/AssetActionNamingCheck.h"
-#include "ProjectSettingsEditor.generated.h"
-
-UENUM()
-enum class EProjectSettingStorage : uint8
-{
-    PSS_ProjectGlobal    UMETA(DisplayName = "Project"),
-    PSS_PerUser          UMETA(DisplayName = "Per user")
-};
-
-USTRUCT()
-struct FNamingConvention
-{
-    GENERATED_BODY()
-
-    UPROPERTY(EditAnywhere)
-    TArray<FPropertyFilter> PropertyFilters;
-    
-    UPROPERTY(EditAnywhere)
-    FString Prefix;
-
-    UPROPERTY(EditAnywhere)
-    FString Suffix;
-};
-
-USTRUCT()
-struct FNamingConventionList
-{
-    GENERATED_BODY()
-
-    UPROPERTY(EditAnywhere)
-    TArray<FNamingConvention> Conventions;
-};
-
-UCLASS()
-class UProjectSettingsEditor : public UObject
-{
-    GENERATED_BODY()
-
-public:
-    static UProjectSettingsEditor& Get();
-
-    void PostEditChangeChainProperty(struct FPropertyChangedChainEvent& PropertyChangedEvent) override;
-
-private:
-    UPROPERTY(EditAnywhere, Category = Settings, meta = (
-        ToolTip = "Where the settings will be saved."),
-        DisplayName = "Settings storage")
-    EProjectSettingStorage SettingStorage = EProjectSettingStorage::PSS_PerUser;
-
-    //TODO rescan assets when changed
-    UPROPERTY(EditAnywhere, Category = Assets, meta = (
-        DisplayName = "Assets naming conventions", ShowOnlyInnerProperties))
-    TMap<TSubclassOf<UObject>, FNamingConventionList> NamingConventions;
-
-    //TODO rescan assets when changed
-    //TODO warning user if no levels are set
-    UPROPERTY(EditAnywhere, Category = Assets, meta = (
-        DisplayName = "Playable levels", ShowOnlyInnerProperties))
-    TArray<UWorld*> PlayableLevels;
-
-    void SaveConfig();
-    void LoadConfig();
-    
-    void PostInitProperties() override;
-#if WITH_EDITOR
-    bool CanEditChange(const FProperty* InProperty) const override;
-#endif
+#pragma once
+#include "CoreMinimal.h"
+#include "Actions/AssetActionNamingCheck.h"
+#include "ProjectSettingsEditor.generated.h"
+
+UENUM()
+enum class EProjectSettingStorage : uint8
+{
+    PSS_ProjectGlobal    UMETA(DisplayName = "Project"),
+    PSS_PerUser          UMETA(DisplayName = "Per user")
+};
+
+USTRUCT()
+struct FNamingConvention
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere)
+    TArray<FPropertyFilter> PropertyFilters;
+    
+    UPROPERTY(EditAnywhere)
+    FString Prefix;
+
+    UPROPERTY(EditAnywhere)
+    FString Suffix;
+
+    UPROPERTY(EditAnywhere, meta = (
+        ToolTip = "Additional checks on the whole name, all rules are evaluated in one pass"))
+    TArray<FNamingRule> Rules;
+};
+
+USTRUCT()
+struct FNamingConventionList
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere)
+    TArray<FNamingConvention> Conventions;
+};
+
+USTRUCT()
+struct FAssetSuppression
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, meta = (
+        ToolTip = "Package path, or a folder ending in / or /* to include everything below it. Segments may contain * and ? wildcards"))
+    FString Path;
+
+    UPROPERTY(EditAnywhere, meta = (
+        ToolTip = "Filter names of the suppressed checks, for example \"Unused assets\". All checks are suppressed when empty"))
+    TArray<FString> Actions;
+};
+
+UCLASS()
+class UProjectSettingsEditor : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    static UProjectSettingsEditor& Get();
+
+    void PostEditChangeChainProperty(struct FPropertyChangedChainEvent& PropertyChangedEvent) override;
+
+private:
+    UPROPERTY(EditAnywhere, Category = Settings, meta = (
+        ToolTip = "Where the settings will be saved."),
+        DisplayName = "Settings storage")
+    EProjectSettingStorage SettingStorage = EProjectSettingStorage::PSS_PerUser;
+
+    UPROPERTY(EditAnywhere, Category = Assets, meta = (
+        DisplayName = "Assets naming conventions", ShowOnlyInnerProperties))
+    TMap<TSubclassOf<UObject>, FNamingConventionList> NamingConventions;
+
+    UPROPERTY(EditAnywhere, Category = Assets, meta = (
+        ToolTip = "Levels used as roots when searching for unused assets. All levels are used when empty.",
+        DisplayName = "Playable levels", ShowOnlyInnerProperties))
+    TArray<TSoftObjectPtr<UWorld>> PlayableLevels;
+
+    UPROPERTY(EditAnywhere, Category = Assets, meta = (
+        ToolTip = "Assets and folders that are intentionally ignored by some or all checks. Suppressed folders are skipped during scans.",
+        DisplayName = "Suppressed assets"))
+    TArray<FAssetSuppression> Suppressions;
+
+    UPROPERTY(EditAnywhere, Category = Scan, meta = (
+        ToolTip = "Folder or network share where per asset results are stored and reused across workspaces and branches. Disabled when empty.",
+        DisplayName = "Shared scan cache"))
+    FDirectoryPath SharedCacheDirectory;
+
+    UPROPERTY(EditAnywhere, Category = Scan, meta = (
+        ToolTip = "Threads of the scan worker pool. 0 uses one thread per core minus the game thread.",
+        DisplayName = "Worker threads", ClampMin = "0", UIMax = "64"))
+    int32 WorkerThreads = 0;
+
+    UPROPERTY(EditAnywhere, Category = Scan, meta = (
+        ToolTip = "Share of the CPU cores scans may use at once. Scans back off further while shaders are compiling.",
+        DisplayName = "CPU share", ClampMin = "1", ClampMax = "100", Units = "Percent"))
+    int32 CpuSharePercent = 75;
+
+    void SaveConfig();
+    void LoadConfig();
+    
+    void PostInitProperties() override;
+#if WITH_EDITOR
+    bool CanEditChange(const FProperty* InProperty) const override;
+#endif
 };
\ No newline at end of file